@@ -62,6 +62,8 @@ int main(int argc, char** argv)
   std::string particleSeperator = " ";
 
   auto reader = make_shared<JetScapeReaderAscii>(argv[1]);
+  // Only final state hadrons are needed, skip the parton showers
+  reader->SetHadronOnly(true);
   std::ofstream dist_output (argv[2]); //Format is SN, PID, E, Px, Py, Pz, Eta, Phi
   vector<shared_ptr<Hadron>> hadrons;
   int SN=0;
@@ -0,0 +1,160 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+// Hadron and anti-kT jet pT spectra from many output files, read in parallel.
+// Each file is normalized with its own sigmaGen / sum of event weights, the
+// files are then averaged (--average, statistically equivalent jobs, default)
+// or added (--sum, e.g. one file per pT-hat bin).
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "JetScapeLogger.h"
+#include "JetScapeReader.h"
+#include "JetScapeAnalysisDriver.h"
+#include "fjcore.hh"
+
+using namespace std;
+using namespace Jetscape;
+
+// -------------------------------------
+
+class HadronSpectraAnalysis {
+
+public:
+  HadronSpectraAnalysis(double m_pt_max = 100., int m_n_bins = 50)
+      : ptMax(m_pt_max), nBins(m_n_bins), hadronSpectrum(m_n_bins, 0.),
+        jetSpectrum(m_n_bins, 0.), jetDef(fjcore::antikt_algorithm, 0.4) {}
+
+  template <class Reader> void Analyze(Reader &reader, double weight) {
+    for (auto &h : reader.GetHadrons()) {
+      if (h->pstat() >= 0 && std::abs(h->eta()) < etaMax)
+        Fill(hadronSpectrum, h->pt(), weight);
+    }
+
+    fjcore::ClusterSequence cs(reader.GetHadronsForFastJet(), jetDef);
+    for (auto &jet : cs.inclusive_jets(jetPtMin)) {
+      if (std::abs(jet.eta()) < etaMax - jetDef.R())
+        Fill(jetSpectrum, jet.pt(), weight);
+    }
+  }
+
+  void Finish(const AnalysisFileSummary &file) {
+    // without a cross section in the file, the spectra are per event
+    double norm = file.sigma_gen > 0. ? file.sigma_gen : 1.;
+    if (file.sum_weights > 0.)
+      norm /= file.sum_weights;
+    for (int i = 0; i < nBins; i++) {
+      hadronSpectrum[i] *= norm;
+      jetSpectrum[i] *= norm;
+    }
+    nFiles = 1;
+  }
+
+  void Merge(const HadronSpectraAnalysis &other) {
+    for (int i = 0; i < nBins; i++) {
+      hadronSpectrum[i] += other.hadronSpectrum[i];
+      jetSpectrum[i] += other.jetSpectrum[i];
+    }
+    nFiles += other.nFiles;
+  }
+
+  void Write(ostream &out, bool average) const {
+    double dpt = ptMax / nBins;
+    double scale = average && nFiles > 0 ? 1. / nFiles : 1.;
+    out << "# pT-bin center, dsigma/dpT for hadrons with |eta| < " << etaMax
+        << ", anti-kT R = " << jetDef.R() << " jets with |eta| < "
+        << etaMax - jetDef.R() << " (" << nFiles << " files)\n";
+    for (int i = 0; i < nBins; i++) {
+      out << (i + 0.5) * dpt << " " << hadronSpectrum[i] * scale / dpt << " "
+          << jetSpectrum[i] * scale / dpt << "\n";
+    }
+  }
+
+private:
+  void Fill(vector<double> &h, double pt, double weight) {
+    int i = static_cast<int>(pt / ptMax * nBins);
+    if (i >= 0 && i < nBins)
+      h[i] += weight;
+  }
+
+  double ptMax;
+  int nBins;
+  double etaMax = 1.0;
+  double jetPtMin = 10.;
+  vector<double> hadronSpectrum;
+  vector<double> jetSpectrum;
+  fjcore::JetDefinition jetDef;
+  int nFiles = 0;
+};
+
+// -------------------------------------
+
+void Usage() {
+  cout << "Usage: ParallelHadronSpectra <output> <input> [<input> ...] [options]"
+       << endl;
+  cout << "  <input>       JetScape Ascii output file (.dat or .dat.gz),"
+       << endl;
+  cout << "                or @<list> for a text file with one file per line"
+       << endl;
+  cout << "  -j <n>        number of threads (default: all cores)" << endl;
+  cout << "  --sum         add the normalized files instead of averaging them"
+       << endl;
+}
+
+int main(int argc, char **argv) {
+  JetScapeLogger::Instance()->SetInfo(false);
+  JetScapeLogger::Instance()->SetDebug(false);
+  JetScapeLogger::Instance()->SetRemark(false);
+  JetScapeLogger::Instance()->SetVerboseLevel(0);
+
+  if (argc < 3) {
+    Usage();
+    return 1;
+  }
+
+  JetScapeAnalysisDriver<HadronSpectraAnalysis> driver;
+  bool average = true;
+  for (int i = 2; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "-j" && i + 1 < argc) {
+      driver.SetNumberOfThreads(atoi(argv[++i]));
+    } else if (arg == "--sum") {
+      average = false;
+    } else if (arg == "--average") {
+      average = true;
+    } else if (arg[0] == '@') {
+      if (!driver.AddFileList(arg.substr(1)))
+        return 1;
+    } else {
+      driver.AddFile(arg);
+    }
+  }
+
+  bool ok = driver.Run();
+
+  int nEvents = 0;
+  for (auto &file : driver.GetFileSummaries())
+    nEvents += file.n_events;
+  cout << "Analyzed " << nEvents << " events from "
+       << driver.GetNumberOfFiles() << " files with "
+       << driver.GetNumberOfThreads() << " threads" << endl;
+
+  ofstream out(argv[1]);
+  driver.GetResult().Write(out, average);
+  return ok ? 0 : 1;
+}
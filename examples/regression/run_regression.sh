@@ -0,0 +1,66 @@
+#!/usr/bin/env bash
+###############################################################################
+# Copyright (c) The JETSCAPE Collaboration, 2018
+#
+# Modular, task-based framework for simulating all aspects of heavy-ion collisions
+#
+# For the list of contributors see AUTHORS.
+#
+# Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+#
+# or via email to bugs.jetscape@gmail.com
+#
+# Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+# See COPYING for details.
+###############################################################################
+
+# Run one fixed-seed regression configuration and compare its event record
+# with the golden file, or replace the golden file with --update.
+#
+# run_regression.sh <runJetscape> <regressionCompare> <user.xml> <main.xml>
+#                   <golden> [--update] [regressionCompare options]
+#
+# Exit codes: 0 agree, 1 differ, 2 run failed, 77 no golden file (skipped).
+
+if [ $# -lt 5 ]; then
+  echo "Usage: $0 <runJetscape> <regressionCompare> <user.xml> <main.xml> <golden> [--update] [options]"
+  exit 2
+fi
+
+RUN=$1
+COMPARE=$2
+USER_XML=$3
+MAIN_XML=$4
+GOLDEN=$5
+shift 5
+
+UPDATE=0
+if [ "$1" == "--update" ]; then
+  UPDATE=1
+  shift
+fi
+
+OUTPUT=$(sed -n 's:.*<outputFilename>\s*\([^< ]*\)\s*</outputFilename>.*:\1:p' "$USER_XML")_regression.dat
+rm -f "$OUTPUT"
+
+if ! "$RUN" "$USER_XML" "$MAIN_XML" > "${OUTPUT%.dat}.log" 2>&1; then
+  echo "runJetscape failed, see ${OUTPUT%.dat}.log"
+  exit 2
+fi
+if [ ! -f "$OUTPUT" ]; then
+  echo "runJetscape did not write $OUTPUT"
+  exit 2
+fi
+
+if [ $UPDATE -eq 1 ]; then
+  cp "$OUTPUT" "$GOLDEN"
+  echo "Updated $GOLDEN"
+  exit 0
+fi
+
+if [ ! -f "$GOLDEN" ]; then
+  echo "No golden file $GOLDEN, skipping. Create it with the regression_update target."
+  exit 77
+fi
+
+"$COMPARE" "$GOLDEN" "$OUTPUT" "$@"
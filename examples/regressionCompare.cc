@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+// Compare two files written by JetScapeWriterRegression
+// and attribute differences to the module that produced them.
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "JetScapeRegressionRecord.h"
+
+using namespace std;
+using namespace Jetscape;
+
+// -------------------------------------
+
+void Usage() {
+  cout << "Usage: regressionCompare <reference> <candidate> [options]" << endl;
+  cout << "  --tolerance <rel>            default relative tolerance (0 = bitwise)" << endl;
+  cout << "  --tolerance <module>=<rel>   tolerance for a module, e.g. Matter=1e-12" << endl;
+  cout << "                               (full section name, module id or kind)" << endl;
+  cout << "  --unordered                  ignore the order of showers, e.g. multi-threaded runs" << endl;
+  cout << "  --max-reports <n>            number of differences to describe (default 10)" << endl;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    Usage();
+    return 2;
+  }
+
+  JetScapeRegressionComparison comparison;
+  for (int i = 3; i < argc; i++) {
+    string arg = argv[i];
+    if (arg == "--unordered") {
+      comparison.SetUnordered(true);
+    } else if ((arg == "--tolerance" || arg == "--max-reports") && i + 1 < argc) {
+      string value = argv[++i];
+      if (arg == "--max-reports") {
+        comparison.SetMaxReports(atoi(value.c_str()));
+        continue;
+      }
+      auto eq = value.find('=');
+      if (eq == string::npos) {
+        comparison.SetDefaultTolerance(atof(value.c_str()));
+      } else {
+        comparison.SetTolerance(value.substr(0, eq),
+                                atof(value.substr(eq + 1).c_str()));
+      }
+    } else {
+      Usage();
+      return 2;
+    }
+  }
+
+  vector<RegressionEvent> reference, candidate;
+  string error;
+  if (!ReadRegressionFile(argv[1], reference, error) ||
+      !ReadRegressionFile(argv[2], candidate, error)) {
+    cerr << error << endl;
+    return 2;
+  }
+
+  bool ok = comparison.Compare(reference, candidate);
+  for (const auto &line : comparison.GetReport()) {
+    cout << line << endl;
+  }
+  if (ok) {
+    cout << "All " << reference.size() << " events agree." << endl;
+    return 0;
+  }
+
+  cout << comparison.GetNumberOfDifferingEvents() << " of "
+       << reference.size() << " events differ. First differing module:" << endl;
+  for (const auto &m : comparison.GetFirstDifferences()) {
+    cout << "  " << m.first << " : " << m.second << " events" << endl;
+  }
+  return 1;
+}
@@ -0,0 +1,48 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+// Xml setup shared by the unit tests
+
+#ifndef TESTXML_H
+#define TESTXML_H
+
+#include "JetScapeXML.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+namespace Jetscape {
+
+/** Opens the main xml file and, as user file, <jetscape> with the given
+    body, written to name_user.xml and removed again once read. Does nothing
+    if a user file is open already, so every test can call it.
+ */
+inline void OpenTestXML(const std::string &name, const std::string &body) {
+  auto xml = JetScapeXML::Instance();
+  if (xml->IsUserFileOpen())
+    return;
+  std::string user_xml = name + "_user.xml";
+  std::ofstream out(user_xml);
+  out << "<jetscape>\n" << body << "</jetscape>\n";
+  out.close();
+  xml->OpenXMLMainFile(JETSCAPE_MAIN_XML);
+  xml->OpenXMLUserFile(user_xml);
+  std::remove(user_xml.c_str());
+}
+
+} // end namespace Jetscape
+
+#endif // TESTXML_H
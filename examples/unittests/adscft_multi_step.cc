@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "AdSCFT.h"
+#include "FluidCellInfo.h"
+#include "JetScapeXML.h"
+#include "TestXML.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Jetscape;
+
+namespace {
+
+const double deltaT = 0.1, maxT = 3.0;
+
+void OpenXML() {
+  std::ostringstream body;
+  body << "  <Eloss>\n"
+       << "    <deltaT>" << deltaT << "</deltaT>\n"
+       << "    <maxT>" << maxT << "</maxT>\n"
+       << "    <AdSCFT>\n"
+       << "      <max_steps>8</max_steps>\n"
+       << "      <step_tolerance>0.02</step_tolerance>\n"
+       << "    </AdSCFT>\n"
+       << "  </Eloss>\n";
+  OpenTestXML("adscft_multi_step", body.str());
+}
+
+void SetAdSCFT(const char *name, double value) {
+  JetScapeXML::Instance()
+      ->GetXMLRootUser()
+      ->FirstChildElement("Eloss")
+      ->FirstChildElement("AdSCFT")
+      ->FirstChildElement(name)
+      ->SetText(value);
+}
+
+// A cooling medium with a small constant flow: the temperature drops by
+// about 1.2% every 4 steps, so updates cover 4 of the 8 allowed steps
+class SlowMedium : public sigslot::has_slots<sigslot::multi_threaded_local> {
+public:
+  void GetHydroCell(double t, double x, double y, double z,
+                    std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
+    fluid_cell_info_ptr = std::unique_ptr<FluidCellInfo>(new FluidCellInfo);
+    fluid_cell_info_ptr->temperature = 0.35 - 0.01 * t;
+    fluid_cell_info_ptr->vx = 0.1;
+    fluid_cell_info_ptr->vy = 0.05;
+    fluid_cell_info_ptr->vz = 0.;
+  }
+};
+
+struct Result {
+  double energy = 0.;
+  int updates = 0, multi_step_updates = 0;
+};
+
+// Steps a quark through the medium the way the JetEnergyLoss loop does, up
+// to and including maxT: the module output replaces the parton, and steps
+// covered by a previous update leave it in place
+Result Quench(int max_steps, double step_tolerance) {
+  SetAdSCFT("max_steps", max_steps);
+  SetAdSCFT("step_tolerance", step_tolerance);
+  SlowMedium medium;
+  auto adscft = make_shared<AdSCFT>();
+  adscft->GetHydroCellSignal.connect(&medium, &SlowMedium::GetHydroCell);
+  adscft->SetJetSignalConnected(true);
+  adscft->Init();
+
+  double t0 = 0.6;
+  Parton quark(1, 1, 0, FourVector(50., 0., 0., 50.), FourVector(0., 0., 0., t0));
+  vector<Parton> pIn{quark};
+
+  Result result;
+  int n_steps = int((maxT - t0) / deltaT + 0.5);
+  for (int n = 0; n <= n_steps; n++) {
+    vector<Parton> pOut;
+    adscft->DoEnergyLoss(deltaT, t0 + n * deltaT, 1., pIn, pOut);
+    if (pOut.empty())
+      continue;
+    EXPECT_EQ(2u, pOut.size());
+    pIn = vector<Parton>{pOut[0]};
+    result.updates++;
+    if (pIn[0].user_info<AdSCFTUserInfo>().steps() > 1)
+      result.multi_step_updates++;
+  }
+  result.energy = pIn[0].e();
+  return result;
+}
+
+} // namespace
+
+// one update over several steps of a slowly varying cell loses the same
+// energy as updating the parton at every step
+TEST(AdSCFTMultiStepTest, TEST_MATCHES_SINGLE_STEPS){
+    OpenXML();
+    // a vanishing tolerance keeps every update to a single step
+    Result single = Quench(8, 1e-9);
+    Result multi = Quench(8, 0.02);
+    EXPECT_EQ(25, single.updates);
+    EXPECT_EQ(0, single.multi_step_updates);
+    EXPECT_LT(multi.updates, single.updates / 2);
+    EXPECT_GT(multi.multi_step_updates, 0);
+
+    double lost = 50. - single.energy;
+    EXPECT_GT(lost, 1.);
+    EXPECT_NEAR(lost, 50. - multi.energy, 5e-3 * lost);
+
+    // and agrees with the per-step Drag of max_steps = 1 within the error of
+    // its endpoint rule
+    Result original = Quench(1, 0.02);
+    EXPECT_EQ(25, original.updates);
+    EXPECT_NEAR(lost, 50. - original.energy, 0.1 * lost);
+}
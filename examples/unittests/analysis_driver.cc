@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "JetScapeAnalysisDriver.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+using namespace Jetscape;
+
+// Counts hadrons and sums their weighted pT, normalized per file
+struct CountingAnalysis {
+  int n_hadrons = 0;
+  double sum_pt = 0.;
+  int n_files = 0;
+
+  template <class Reader> void Analyze(Reader &reader, double weight) {
+    for (auto &h : reader.GetHadrons()) {
+      n_hadrons++;
+      sum_pt += weight * h->pt();
+    }
+  }
+  void Finish(const AnalysisFileSummary &file) {
+    sum_pt *= file.sigma_gen / file.sum_weights;
+    n_files = 1;
+  }
+  void Merge(const CountingAnalysis &other) {
+    n_hadrons += other.n_hadrons;
+    sum_pt += other.sum_pt;
+    n_files += other.n_files;
+  }
+};
+
+// File f has f + 1 events with event weight f + 1 and two hadrons each
+std::string WriteTestFile(int f) {
+  std::string name = "analysis_driver_test_" + std::to_string(f) + ".dat";
+  std::ofstream out(name.c_str());
+  for (int ev = 0; ev <= f; ev++) {
+    out << ev << " Event\n";
+    out << "# JetScape sigmaGen " << 10. * (f + 1) << "\n";
+    out << "# JetScape sigmaErr 0.1\n";
+    out << "# JetScape weight " << f + 1 << "\n";
+    for (int i = 0; i < 2; i++) {
+      out << "[" << i << "] H " << i << " 211 0 " << 2. + i
+          << " 0.5 1.0 5.0 0 0 0 0\n";
+    }
+  }
+  return name;
+}
+
+TEST(JetScapeAnalysisDriverTest, TEST_THREADS) {
+  const int nFiles = 5;
+  std::vector<std::string> files;
+  for (int f = 0; f < nFiles; f++)
+    files.push_back(WriteTestFile(f));
+
+  JetScapeLogger::Instance()->SetInfo(false);
+
+  for (int nThreads : {1, 3}) {
+    JetScapeAnalysisDriver<CountingAnalysis> driver;
+    for (auto &file : files)
+      driver.AddFile(file);
+    driver.AddFile("analysis_driver_test_missing.dat");
+    driver.SetNumberOfThreads(nThreads);
+
+    // the missing file is reported, the others are still analyzed
+    EXPECT_FALSE(driver.Run());
+    EXPECT_EQ(driver.GetNumberOfThreads(), nThreads);
+
+    const auto &summaries = driver.GetFileSummaries();
+    ASSERT_EQ(summaries.size(), nFiles + 1);
+    for (int f = 0; f < nFiles; f++) {
+      EXPECT_TRUE(summaries[f].ok);
+      EXPECT_EQ(summaries[f].n_events, f + 1);
+      EXPECT_DOUBLE_EQ(summaries[f].sum_weights, (f + 1) * (f + 1));
+      EXPECT_DOUBLE_EQ(summaries[f].sigma_gen, 10. * (f + 1));
+    }
+    EXPECT_FALSE(summaries[nFiles].ok);
+
+    // every file contributes sigmaGen * <sum pT> = 10 (f + 1) * 5
+    const CountingAnalysis &result = driver.GetResult();
+    EXPECT_EQ(result.n_files, nFiles);
+    EXPECT_EQ(result.n_hadrons, 2 * nFiles * (nFiles + 1) / 2);
+    EXPECT_NEAR(result.sum_pt, 50. * nFiles * (nFiles + 1) / 2, 1e-9);
+  }
+
+  for (auto &file : files)
+    std::remove(file.c_str());
+}
+
+// events without hadrons still count, in the default hadron-only mode as
+// well, and text after the last event or an empty file adds no event
+TEST(JetScapeAnalysisDriverTest, TEST_EVENTS_WITHOUT_HADRONS) {
+  std::string parton_file = "analysis_driver_test_partons.dat";
+  std::ofstream out(parton_file.c_str());
+  for (int ev = 0; ev < 3; ev++) {
+    out << ev << " Event\n";
+    out << "# JetScape weight 2\n";
+    out << "[0] V 0 0 0 0\n[1] V 0 0 0 0\n";
+    out << "[0]=>[1] P 0 21 0 10 0.5 1.0 10.0\n";
+  }
+  out << "# JetScape sigmaGen 5\n# JetScape sigmaErr 0.1\n";
+  out.close();
+  std::string empty_file = "analysis_driver_test_empty.dat";
+  std::ofstream(empty_file.c_str()).close();
+
+  JetScapeLogger::Instance()->SetInfo(false);
+  for (bool hadronOnly : {true, false}) {
+    JetScapeAnalysisDriver<CountingAnalysis> driver;
+    driver.AddFile(parton_file);
+    driver.AddFile(empty_file);
+    driver.SetNumberOfThreads(1);
+    driver.SetHadronOnly(hadronOnly);
+    EXPECT_TRUE(driver.Run());
+
+    const auto &summaries = driver.GetFileSummaries();
+    ASSERT_EQ(summaries.size(), 2u);
+    EXPECT_EQ(summaries[0].n_events, 3);
+    EXPECT_DOUBLE_EQ(summaries[0].sum_weights, 6.);
+    EXPECT_DOUBLE_EQ(summaries[0].sigma_gen, 5.);
+    EXPECT_TRUE(summaries[1].ok);
+    EXPECT_EQ(summaries[1].n_events, 0);
+  }
+
+  std::remove(parton_file.c_str());
+  std::remove(empty_file.c_str());
+}
@@ -0,0 +1,131 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "JetEnergyLoss.h"
+#include "JetEnergyLossModule.h"
+#include "JetScapeRegressionRecord.h"
+#include "JetScapeWriterRegression.h"
+#include "JetScapeXML.h"
+#include "TestXML.h"
+#include "PartonShower.h"
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace Jetscape;
+
+namespace {
+
+// Showers of the toy module below, written by the DoShower step loop as it
+// was before the partons were updated in place (copy per module call).
+const std::string golden =
+    std::string(REGRESSION_GOLDEN_DIR) + "/toy_eloss_showers.dat";
+
+void OpenXML() {
+  OpenTestXML("eloss_shower_graph",
+              "  <Eloss>\n"
+              "    <deltaT>0.1</deltaT>\n"
+              "    <maxT>8</maxT>\n"
+              "  </Eloss>\n");
+}
+
+// Exercises every way a module hands partons back: an in-place update of
+// pIn without output, a single propagated parton (sometimes a photon), a
+// split into two daughters, and extra shower roots appended to pIn.
+class ToyEloss : public JetEnergyLossModule<ToyEloss> {
+public:
+  ToyEloss() { SetId("ToyEloss"); }
+
+  void Init() {}
+
+  void DoEnergyLoss(double deltaT, double time, double Q2, vector<Parton> &pIn,
+                    vector<Parton> &pOut) {
+    std::uniform_real_distribution<double> u(0, 1);
+    double r = u(rng);
+    Parton &p = pIn[0];
+    if (r < 0.25) {
+      p.set_form_time(time + u(rng));
+      u(rng);
+    } else if (r < 0.5 || p.pt() < 2) {
+      Parton q(p);
+      q.reset_momentum(q.px() * 0.97, q.py() * 0.97, q.pz() * 0.97,
+                       q.e() * 0.97);
+      if (u(rng) < 0.05)
+        q.set_id(22);
+      pOut.push_back(q);
+    } else {
+      double z = 0.2 + 0.6 * u(rng);
+      for (int k = 0; k < 2; k++) {
+        double f = k == 0 ? z : 1 - z;
+        Parton q(label++, k == 0 ? p.pid() : 21, 0,
+                 FourVector(p.px() * f, p.py() * f, p.pz() * f, p.e() * f),
+                 FourVector(0, 0, 0, time));
+        u(rng);
+        pOut.push_back(q);
+      }
+      if (u(rng) < 0.1) {
+        Parton root(label++, 21, 0, FourVector(0.1, 0, 0, 0.1),
+                    FourVector(0, 0, 0, time));
+        pIn.push_back(root);
+      }
+    }
+  }
+
+  std::mt19937 rng;
+  int label = 100;
+};
+
+void WriteToyShowers(const std::string &file_name) {
+  JetScapeWriterRegression writer(file_name);
+  writer.Init();
+  for (int ev = 0; ev < 10; ev++) {
+    auto eloss = make_shared<JetEnergyLoss>();
+    auto toy = make_shared<ToyEloss>();
+    toy->rng.seed(ev);
+    eloss->Add(toy);
+    eloss->SentInPartons.connect(toy.get(), &ToyEloss::DoEnergyLoss);
+    eloss->Init();
+    eloss->AddShowerInitiatingParton(make_shared<Parton>(
+        1, 1, 0, FourVector(20 + ev, 3, 40, 45 + ev), FourVector(0, 0, 0, 0)));
+    eloss->Exec();
+
+    JetScapeModuleBase::SetCurrentEvent(ev);
+    writer.WriteHeaderToFile();
+    writer.WriteComment("Energy loss Shower Initating Parton: JetEnergyLoss");
+    writer.Write(eloss->GetShower());
+  }
+  writer.Close();
+}
+
+} // namespace
+
+// the shower graphs (vertices, edges and their order) do not depend on how
+// the step loop moves partons between its buffers
+TEST(ElossShowerGraphTest, TEST_TOY_SHOWERS){
+    OpenXML();
+    WriteToyShowers("eloss_shower_graph_test.dat");
+    std::vector<RegressionEvent> reference, candidate;
+    std::string error;
+    ASSERT_TRUE(ReadRegressionFile(golden, reference, error)) << error;
+    ASSERT_TRUE(ReadRegressionFile("eloss_shower_graph_test.dat", candidate,
+                                   error)) << error;
+    ASSERT_EQ(10u, candidate.size());
+    JetScapeRegressionComparison comparison;
+    EXPECT_TRUE(comparison.Compare(reference, candidate));
+}
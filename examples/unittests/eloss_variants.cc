@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "JetEnergyLoss.h"
+#include "JetEnergyLossManager.h"
+#include "JetEnergyLossModule.h"
+#include "JetScapeReader.h"
+#include "JetScapeTaskSupport.h"
+#include "JetScapeWriterStream.h"
+#include "JetScapeXML.h"
+#include "TestXML.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Jetscape;
+
+namespace {
+
+const double main_factor = 0.9, variant_factor = 0.5;
+
+void OpenXML() {
+  std::ostringstream body;
+  body << "  <Eloss>\n"
+       << "    <deltaT>0.1</deltaT>\n"
+       << "    <maxT>1</maxT>\n"
+       << "    <toy_factor>" << main_factor << "</toy_factor>\n"
+       << "    <Variants>\n"
+       << "      <Variant name=\"low\"> <toy_factor>" << variant_factor
+       << "</toy_factor> </Variant>\n"
+       << "    </Variants>\n"
+       << "  </Eloss>\n";
+  OpenTestXML("eloss_variants", body.str());
+}
+
+// Scales the momentum of the shower initiating parton by toy_factor in the
+// first step, before it enters the shower, and leaves it alone afterwards
+class ToyEloss : public JetEnergyLossModule<ToyEloss> {
+public:
+  ToyEloss() { SetId("ToyEloss"); }
+
+  void Init() { factor = GetXMLElementDouble({"Eloss", "toy_factor"}); }
+
+  void DoEnergyLoss(double deltaT, double time, double Q2, vector<Parton> &pIn,
+                    vector<Parton> &pOut) {
+    if (time > 1.5 * deltaT)
+      return;
+    Parton &p = pIn[0];
+    p.reset_momentum(factor * p.px(), factor * p.py(), factor * p.pz(),
+                     factor * p.e());
+  }
+
+  double factor = 0.;
+};
+
+class ToyHardProcess : public sigslot::has_slots<> {
+public:
+  void GetHardPartonList(vector<shared_ptr<Parton>> &hp) { hp = partons; }
+
+  void SetPartons(int n) {
+    partons.clear();
+    for (int i = 0; i < n; i++)
+      partons.push_back(make_shared<Parton>(
+          i, 21, 0, FourVector(0., 0., 10. * (i + 1), 10. * (i + 1)),
+          FourVector(0., 0., 0., 0.)));
+  }
+
+  vector<shared_ptr<Parton>> partons;
+};
+
+// A manager with the main run and one Eloss variant, as JetScape sets it up
+shared_ptr<JetEnergyLossManager> MakeManager(ToyHardProcess &hard) {
+  auto manager = make_shared<JetEnergyLossManager>();
+  auto main_eloss = make_shared<JetEnergyLoss>();
+  main_eloss->Add(make_shared<ToyEloss>());
+  manager->Add(main_eloss);
+  auto variant_eloss = make_shared<JetEnergyLoss>();
+  variant_eloss->SetVariant("low", JetScapeXML::Instance()
+                                       ->GetXMLRootUser()
+                                       ->FirstChildElement("Eloss")
+                                       ->FirstChildElement("Variants")
+                                       ->FirstChildElement("Variant"));
+  variant_eloss->Add(make_shared<ToyEloss>());
+  manager->Add(variant_eloss);
+  manager->Init();
+  manager->GetHardPartonList.connect(&hard, &ToyHardProcess::GetHardPartonList);
+  manager->SetGetHardPartonListConnected(true);
+  return manager;
+}
+
+double FinalEnergy(shared_ptr<JetScapeTask> task) {
+  auto shower = std::dynamic_pointer_cast<JetEnergyLoss>(task)->GetShower();
+  auto final_partons = shower->GetFinalPartons();
+  EXPECT_EQ(1u, final_partons.size());
+  return final_partons.empty() ? 0. : final_partons[0]->e();
+}
+
+} // namespace
+
+// the configured tasks shower the first hard parton, the copies of the main
+// run and then those of the variant the others, and Clear removes the copies
+TEST(ElossVariantsTest, TEST_SHARED_EVENT){
+    OpenXML();
+    ToyHardProcess hard;
+    auto manager = MakeManager(hard);
+    auto main_eloss =
+        std::dynamic_pointer_cast<JetEnergyLoss>(manager->GetTaskAt(0));
+
+    for (int n_hard : {3, 2, 1}) {
+      hard.SetPartons(n_hard);
+      manager->Exec();
+      int n_tasks = manager->GetNumberOfTasks();
+      ASSERT_EQ(2 * n_hard, n_tasks);
+      for (int n = 0; n < n_tasks; n++) {
+        auto jloss = std::dynamic_pointer_cast<JetEnergyLoss>(manager->GetTaskAt(n));
+        bool variant = n == 1 || n >= 2 + (n_hard - 1);
+        EXPECT_EQ(variant ? "low" : "", jloss->GetVariant());
+        int i = n < 2 ? 0 : 1 + (n - 2) % (n_hard - 1);
+        EXPECT_DOUBLE_EQ((variant ? variant_factor : main_factor) *
+                             hard.partons[i]->e(),
+                         FinalEnergy(jloss));
+      }
+      // the variants showered copies, the hard partons are unchanged
+      for (int i = 0; i < n_hard; i++)
+        EXPECT_DOUBLE_EQ(10. * (i + 1), hard.partons[i]->e());
+
+      // the main run collects the final partons by variant
+      vector<vector<shared_ptr<Parton>>> main_partons, variant_partons;
+      main_eloss->SendFinalStatePartons(main_partons);
+      ASSERT_TRUE(main_eloss->SendVariantFinalStatePartons("low",
+                                                           variant_partons));
+      ASSERT_EQ((unsigned)n_hard, main_partons.size());
+      ASSERT_EQ((unsigned)n_hard, variant_partons.size());
+      EXPECT_FALSE(main_eloss->SendVariantFinalStatePartons("other",
+                                                            variant_partons));
+
+      manager->Clear();
+      ASSERT_EQ(2, manager->GetNumberOfTasks());
+      EXPECT_EQ(main_eloss, manager->GetTaskAt(0));
+      EXPECT_EQ("low", std::dynamic_pointer_cast<JetEnergyLoss>(manager->GetTaskAt(1))
+                           ->GetVariant());
+      main_eloss->SendFinalStatePartons(main_partons);
+      EXPECT_TRUE(main_partons.empty());
+    }
+}
+
+// writers of the variant get its showers, all others the main showers, and
+// an inactive manager writes nothing
+TEST(ElossVariantsTest, TEST_WRITERS){
+    OpenXML();
+    ToyHardProcess hard;
+    auto manager = MakeManager(hard);
+    hard.SetPartons(2);
+    manager->Exec();
+
+    const std::string variants[] = {"", "low", "hadro"};
+    for (bool active : {true, false}) {
+      manager->SetActive(active);
+      for (auto &variant : variants) {
+        std::string file_name = "eloss_variants_" + variant + ".dat";
+        auto writer = make_shared<JetScapeWriterAscii>(file_name);
+        writer->SetVariant(variant);
+        writer->Init();
+        JetScapeModuleBase::SetCurrentEvent(0);
+        writer->WriteHeaderToFile();
+        manager->WriteTask(writer);
+        writer->Close();
+
+        auto reader = make_shared<JetScapeReaderAscii>(file_name);
+        reader->Next();
+        auto showers = reader->GetPartonShowers();
+        std::remove(file_name.c_str());
+        if (!active) {
+          for (auto &shower : showers)
+            EXPECT_EQ(0, shower->GetNumberOfPartons());
+          continue;
+        }
+        ASSERT_EQ(2u, showers.size());
+        double factor = variant == "low" ? variant_factor : main_factor;
+        for (int i = 0; i < 2; i++) {
+          auto final_partons = showers[i]->GetFinalPartons();
+          ASSERT_EQ(1u, final_partons.size());
+          EXPECT_NEAR(factor * 10. * (i + 1), final_partons[0]->e(), 1e-4);
+        }
+      }
+    }
+    manager->Clear();
+}
+
+// the modules of a variant, and their copies, draw from an engine of their
+// own, which every event starts on a stream of its own
+TEST(ElossVariantsTest, TEST_VARIANT_ENGINE){
+    OpenXML();
+    JetScapeTaskSupport::ReadSeedFromXML();
+    ToyHardProcess hard;
+    auto manager = MakeManager(hard);
+    auto main_module = std::dynamic_pointer_cast<JetScapeModuleBase>(
+        manager->GetTaskAt(0)->GetTaskAt(0));
+    auto variant_module = std::dynamic_pointer_cast<JetScapeModuleBase>(
+        manager->GetTaskAt(1)->GetTaskAt(0));
+    auto engine = variant_module->GetMt19937Generator();
+    EXPECT_NE(main_module->GetMt19937Generator(), engine);
+
+    hard.SetPartons(2);
+    std::vector<unsigned int> draws;
+    for (int event : {3, 4, 3}) {
+      JetScapeModuleBase::SetCurrentEvent(event);
+      manager->Exec();
+      auto copy = std::dynamic_pointer_cast<JetScapeModuleBase>(
+          manager->GetTaskAt(3)->GetTaskAt(0));
+      EXPECT_EQ(engine, copy->GetMt19937Generator());
+      draws.push_back((*engine)());
+      manager->Clear();
+    }
+    EXPECT_NE(draws[0], draws[1]);
+    EXPECT_EQ(draws[0], draws[2]);
+}
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "JetScapeEventMemory.h"
+#include "JetClass.h"
+#include "gtest/gtest.h"
+
+using namespace Jetscape;
+
+// outside of an event nothing is pooled
+TEST(JetScapeEventMemoryTest, TEST_OUTSIDE_EVENT) {
+  auto memory = JetScapeEventMemory::Instance();
+  long before = memory->GetLiveAllocations();
+  auto v = MakeEventShared<Vertex>(1, 2, 3, 4);
+  EXPECT_EQ(memory->GetLiveAllocations(), before);
+  EXPECT_DOUBLE_EQ(v->x_in().t(), 4);
+}
+
+// the pool is only released once nothing references it anymore
+TEST(JetScapeEventMemoryTest, TEST_RELEASE) {
+  auto memory = JetScapeEventMemory::Instance();
+
+  memory->BeginEvent();
+  EXPECT_TRUE(JetScapeEventMemory::InEvent());
+  auto v = MakeEventShared<Vertex>(1, 2, 3, 4);
+  auto w = MakeEventShared<Vertex>(*v);
+  EXPECT_EQ(memory->GetLiveAllocations(), 2);
+  w = nullptr;
+  EXPECT_EQ(memory->GetLiveAllocations(), 1);
+  // v is still referenced, keep the pool
+  EXPECT_FALSE(memory->EndEvent());
+  EXPECT_FALSE(JetScapeEventMemory::InEvent());
+  EXPECT_DOUBLE_EQ(v->x_in().x(), 1);
+
+  memory->BeginEvent();
+  v = nullptr;
+  EXPECT_EQ(memory->GetLiveAllocations(), 0);
+  EXPECT_TRUE(memory->EndEvent());
+}
+
+// several open events share the pool, the last one releases it
+TEST(JetScapeEventMemoryTest, TEST_NESTED_EVENTS) {
+  auto memory = JetScapeEventMemory::Instance();
+
+  memory->BeginEvent();
+  memory->BeginEvent();
+  { auto v = MakeEventShared<Vertex>(); }
+  EXPECT_FALSE(memory->EndEvent());
+  EXPECT_TRUE(memory->EndEvent());
+}
@@ -17,6 +17,8 @@
 #include "FluidEvolutionHistory.h"
 #include "gtest/gtest.h"
 
+#include <cmath>
+
 using namespace Jetscape;
 
 void test_not_in_range(EvolutionHistory hist, real tau, real x, real y, real eta) {
@@ -69,3 +71,173 @@ TEST(EvolutionHistoryTest, TEST_WRITE){
     // check almost equal for two float numbers
     ASSERT_NEAR(hist.get(0.8, 0.0, 0.0, 0.0).energy_density, static_cast<real>(const_ed), 1.0E-6);
 }
+
+// a cooling fireball in a large, mostly empty box
+EvolutionHistory fireball_grid() {
+    auto hist = EvolutionHistory();
+    hist.tau_min = 0.6;
+    hist.dtau = 0.1;
+    hist.x_min = -15;
+    hist.y_min = -15;
+    hist.eta_min = 0;
+    hist.dx = 0.25;
+    hist.dy = 0.25;
+    hist.deta = 0.1;
+    hist.ntau = 40;
+    hist.nx = 121;
+    hist.ny = 121;
+    hist.neta = 1;
+    hist.tau_eta_is_tz = false;
+    hist.boost_invariant = true;
+    return hist;
+}
+
+FluidCellInfo fireball_cell(const EvolutionHistory &hist, int n, int i, int j) {
+    real tau = hist.TauCoord(n), x = hist.XCoord(i), y = hist.YCoord(j);
+    auto cell = FluidCellInfo();
+    cell.temperature = 0.4 * std::pow(0.6 / tau, 1. / 3.) *
+                       std::exp(-(x * x + y * y) / 18.);
+    cell.energy_density = 13.8 * std::pow(cell.temperature, 4);
+    cell.vx = 0.05 * x * (tau - 0.5);
+    return cell;
+}
+
+// sparse storage of the fireball
+TEST(EvolutionHistoryTest, TEST_SPARSE){
+    auto hist = fireball_grid();
+    for (int n=0; n != hist.ntau; n++)
+        for (int i=0; i != hist.nx; i++)
+            for (int j=0; j != hist.ny; j++)
+                hist.data.emplace_back(fireball_cell(hist, n, i, j));
+    std::vector<FluidCellInfo> dense = hist.data;
+    auto dense_bytes = hist.GetMemoryFootprint();
+
+    real T_min = 0.1, tolerance = 0.005;
+    hist.Sparsify(T_min, tolerance, 4, 4);
+    ASSERT_TRUE(hist.is_sparse());
+    EXPECT_EQ(hist.get_data_size(), static_cast<int>(dense.size()));
+    EXPECT_LT(hist.GetMemoryFootprint() * 5, dense_bytes);
+
+    real max_T = 0.4, max_ed = 13.8 * std::pow(max_T, 4);
+    real max_vx = 0.0;
+    for (const auto &cell : dense) max_vx = std::max(max_vx, std::abs(cell.vx));
+    for (int n=0; n != hist.ntau; n++)
+        for (int i=0; i != hist.nx; i++)
+            for (int j=0; j != hist.ny; j++) {
+                const auto &exact = dense[hist.CellIndex(n, i, j, 0)];
+                auto cell = hist.GetFluidCell(n, i, j, 0);
+                if (exact.temperature < T_min && cell.temperature < T_min)
+                    continue;
+                ASSERT_NEAR(cell.temperature, exact.temperature, tolerance * max_T * 1.0001);
+                ASSERT_NEAR(cell.energy_density, exact.energy_density, tolerance * max_ed * 1.0001);
+                ASSERT_NEAR(cell.vx, exact.vx, tolerance * max_vx * 1.0001);
+            }
+
+    // the cold corner of the box reads as vacuum
+    auto corner = hist.get(1.0, -14.5, -14.5, 0.0);
+    EXPECT_EQ(corner.temperature, 0.0);
+    EXPECT_EQ(corner.energy_density, 0.0);
+    // the hot center is interpolated as before
+    ASSERT_NEAR(hist.get(1.05, 0.1, 0.1, 0.0).temperature,
+                0.4 * std::pow(0.6 / 1.05, 1. / 3.), 0.01);
+}
+
+// the sparse storage built while the slices are filled never holds more
+// than max_tau_stride dense slices and keeps the same error bound
+TEST(EvolutionHistoryTest, TEST_SPARSE_FILLING){
+    auto hist = fireball_grid();
+    real T_min = 0.1, tolerance = 0.005;
+    int max_tau_stride = 4;
+    hist.StartSparseFilling(T_min, tolerance, 4, max_tau_stride);
+    std::size_t peak_cells = 0;
+    std::vector<FluidCellInfo> dense;
+    for (int n=0; n != hist.ntau; n++) {
+        for (int i=0; i != hist.nx; i++)
+            for (int j=0; j != hist.ny; j++) {
+                hist.data.emplace_back(fireball_cell(hist, n, i, j));
+                dense.push_back(hist.data.back());
+            }
+        peak_cells = std::max(peak_cells, hist.data.size());
+        hist.SparsifyFilledSlices();
+    }
+    hist.FinishSparseFilling();
+    ASSERT_TRUE(hist.is_sparse());
+    EXPECT_FALSE(hist.is_sparse_filling());
+    EXPECT_LE(peak_cells, static_cast<std::size_t>(
+        (max_tau_stride + 1) * hist.GetTauSliceSize()));
+
+    real max_T = 0.4, max_ed = 13.8 * std::pow(max_T, 4);
+    real max_vx = 0.0;
+    for (const auto &cell : dense) max_vx = std::max(max_vx, std::abs(cell.vx));
+    for (int n=0; n != hist.ntau; n++)
+        for (int i=0; i != hist.nx; i++)
+            for (int j=0; j != hist.ny; j++) {
+                const auto &exact = dense[hist.CellIndex(n, i, j, 0)];
+                auto cell = hist.GetFluidCell(n, i, j, 0);
+                if (exact.temperature < T_min && cell.temperature < T_min)
+                    continue;
+                ASSERT_NEAR(cell.temperature, exact.temperature, tolerance * max_T * 1.0001);
+                ASSERT_NEAR(cell.energy_density, exact.energy_density, tolerance * max_ed * 1.0001);
+                ASSERT_NEAR(cell.vx, exact.vx, tolerance * max_vx * 1.0001);
+            }
+}
+
+// points outside the grid read as the vacuum cell, dense or sparse
+TEST(EvolutionHistoryTest, TEST_SPARSE_OUT_OF_GRID){
+    auto hist = fireball_grid();
+    for (int n=0; n != hist.ntau; n++)
+        for (int i=0; i != hist.nx; i++)
+            for (int j=0; j != hist.ny; j++)
+                hist.data.emplace_back(fireball_cell(hist, n, i, j));
+
+    auto expect_vacuum = [](const FluidCellInfo &cell) {
+        EXPECT_EQ(cell.energy_density, 0.0);
+        EXPECT_EQ(cell.entropy_density, 0.0);
+        EXPECT_EQ(cell.temperature, 0.0);
+        EXPECT_EQ(cell.pressure, 0.0);
+        EXPECT_EQ(cell.vx, 0.0);
+        EXPECT_EQ(cell.vy, 0.0);
+        EXPECT_EQ(cell.vz, 0.0);
+        EXPECT_EQ(cell.bulk_Pi, 0.0);
+        for (int i = 0; i < 4; i++)
+            for (int j = 0; j < 4; j++)
+                EXPECT_EQ(cell.pi[i][j], 0.0);
+    };
+    for (bool sparse : {false, true}) {
+        if (sparse) hist.Sparsify(0.1, 0.005, 4, 4);
+        ASSERT_EQ(sparse, hist.is_sparse());
+        // before the start, after the end, beyond the box in x and y
+        expect_vacuum(hist.get(0.5, 0.0, 0.0, 0.0));
+        expect_vacuum(hist.get(hist.TauMax() + 0.05, 0.0, 0.0, 0.0));
+        expect_vacuum(hist.get(1.0, hist.XMax() + 0.1, 0.0, 0.0));
+        expect_vacuum(hist.get(1.0, 0.0, hist.YMin() - 0.1, 0.0));
+        expect_vacuum(hist.get_tz(1.0, 16.0, 0.0, 0.0));
+        // the center is not
+        EXPECT_GT(hist.get(1.0, 0.0, 0.0, 0.0).temperature, 0.3);
+    }
+}
+
+// a medium with a constant energy density everywhere
+class ConstantMedium : public FluidDynamics {
+public:
+    explicit ConstantMedium(real ed) : ed_(ed) {}
+    void GetHydroInfo(real t, real x, real y, real z,
+                      std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
+        ResetFluidCellInfo(fluid_cell_info_ptr);
+        fluid_cell_info_ptr->energy_density = ed_;
+        fluid_cell_info_ptr->temperature = 0.3;
+    }
+private:
+    real ed_;
+};
+
+// test the difference between two media, e.g. the medium response
+TEST(FluidDynamicsTest, TEST_DIFFERENCE){
+    ConstantMedium background(0.8);
+    ConstantMedium with_sources(1.1);
+
+    std::unique_ptr<FluidCellInfo> cell;
+    with_sources.GetHydroInfoDifference(1.0, 0.0, 0.0, 0.0, background, cell);
+    ASSERT_NEAR(cell->energy_density, static_cast<real>(0.3), 1.0E-6);
+    ASSERT_NEAR(cell->temperature, static_cast<real>(0.0), 1.0E-6);
+}
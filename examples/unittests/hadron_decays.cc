@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "HadronDecays.h"
+#include "JetScapeXML.h"
+#include "TestXML.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Jetscape;
+
+namespace {
+
+void OpenXML() {
+  OpenTestXML("hadron_decays",
+              "  <JetHadronization><name>colorless</name></JetHadronization>\n"
+              "  <HadronDecays>\n"
+              "    <n_threads>1</n_threads>\n"
+              "    <chunk_size>8</chunk_size>\n"
+              "  </HadronDecays>\n");
+}
+
+void SetThreads(int n_threads) {
+  JetScapeXML::Instance()
+      ->GetXMLRootUser()
+      ->FirstChildElement("HadronDecays")
+      ->FirstChildElement("n_threads")
+      ->SetText(n_threads);
+}
+
+// Short-lived resonances mixed with hadrons that do not decay, with the
+// status codes of the hybrid hadronization
+vector<shared_ptr<Hadron>> ToyHadrons() {
+  const int ids[] = {113, 211, 223, 111, 2224, 310, 221, -213, 3212, 2212};
+  const int stats[] = {811, 812, 821, -822};
+  vector<shared_ptr<Hadron>> hadrons;
+  for (int i = 0; i < 100; i++) {
+    double px = 0.3 * (i % 7) - 1.0, py = 0.2 * (i % 5), pz = 0.5 * i - 20.;
+    auto h = make_shared<Hadron>(i, ids[i % 10], stats[i % 4],
+                                 FourVector(px, py, pz, 0.),
+                                 FourVector(0.1 * i, 0., 0., 1.));
+    // put the hadron on its mass shell
+    double m = h->restmass();
+    h->reset_momentum(px, py, pz, std::sqrt(px * px + py * py + pz * pz + m * m));
+    hadrons.push_back(h);
+  }
+  return hadrons;
+}
+
+vector<shared_ptr<Hadron>> Decay(int n_threads, unsigned long seed) {
+  SetThreads(n_threads);
+  auto decays = make_shared<HadronDecays>();
+  decays->Init();
+  EXPECT_EQ(n_threads, decays->GetNumberOfThreads());
+  auto hadrons = ToyHadrons();
+  decays->DecayHadrons(hadrons, seed);
+  return hadrons;
+}
+
+} // namespace
+
+TEST(HadronDecaysTest, TEST_THREAD_INDEPENDENCE){
+    OpenXML();
+    auto serial = Decay(1, 12345);
+    auto parallel = Decay(4, 12345);
+
+    // the resonances decayed
+    EXPECT_GT(serial.size(), ToyHadrons().size());
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (unsigned int i = 0; i < serial.size(); i++) {
+      EXPECT_EQ(serial[i]->pid(), parallel[i]->pid());
+      EXPECT_EQ(serial[i]->plabel(), parallel[i]->plabel());
+      EXPECT_EQ(serial[i]->pstat(), parallel[i]->pstat());
+      EXPECT_EQ(serial[i]->px(), parallel[i]->px());
+      EXPECT_EQ(serial[i]->py(), parallel[i]->py());
+      EXPECT_EQ(serial[i]->pz(), parallel[i]->pz());
+      EXPECT_EQ(serial[i]->e(), parallel[i]->e());
+    }
+
+    // another event seed gives other decays
+    auto reseeded = Decay(4, 54321);
+    bool differs = reseeded.size() != serial.size();
+    for (unsigned int i = 0; !differs && i < serial.size(); i++)
+      differs = serial[i]->px() != reseeded[i]->px();
+    EXPECT_TRUE(differs);
+}
+
+TEST(HadronDecaysTest, TEST_STATUS_KEPT){
+    OpenXML();
+    auto hadrons = ToyHadrons();
+    auto decayed = Decay(2, 777);
+    // every product carries the label and status of its mother
+    for (auto &h : decayed) {
+      ASSERT_GE(h->plabel(), 0);
+      ASSERT_LT(h->plabel(), (int)hadrons.size());
+      EXPECT_EQ(hadrons[h->plabel()]->pstat(), h->pstat());
+    }
+}
+
+TEST(HadronDecaysTest, TEST_TASK_ORDER){
+    tinyxml2::XMLDocument doc;
+    doc.Parse("<jetscape><JetHadronization/><SoftParticlization/>"
+              "<HadronDecays/></jetscape>");
+    EXPECT_TRUE(HadronDecays::FollowsHadronization(doc.RootElement(), true));
+
+    doc.Parse("<jetscape><JetHadronization/><HadronDecays/>"
+              "<SoftParticlization/></jetscape>");
+    EXPECT_TRUE(HadronDecays::FollowsHadronization(doc.RootElement(), false));
+    EXPECT_FALSE(HadronDecays::FollowsHadronization(doc.RootElement(), true));
+
+    doc.Parse("<jetscape><HadronDecays/><JetHadronization/></jetscape>");
+    EXPECT_FALSE(HadronDecays::FollowsHadronization(doc.RootElement(), false));
+}
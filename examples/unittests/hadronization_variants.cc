@@ -0,0 +1,181 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "HadronizationManager.h"
+#include "HadronizationModule.h"
+#include "JetScapeReader.h"
+#include "JetScapeWriterStream.h"
+#include "JetScapeXML.h"
+#include "TestXML.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Jetscape;
+
+namespace {
+
+void OpenXML() {
+  OpenTestXML("hadronization_variants",
+              "  <JetHadronization>\n"
+              "    <name>colorless</name>\n"
+              "    <toy_scale>1.0</toy_scale>\n"
+              "    <toy_id>211</toy_id>\n"
+              "    <Variants>\n"
+              "      <Variant name=\"half\"> <toy_scale>0.5</toy_scale> </Variant>\n"
+              "    </Variants>\n"
+              "  </JetHadronization>\n");
+}
+
+// Turns every parton into a hadron with its momentum scaled by toy_scale
+class ToyHadronization : public HadronizationModule<ToyHadronization> {
+public:
+  ToyHadronization() { SetId("ToyHadronization"); }
+
+  void Init() {
+    scale = GetXMLElementDouble({"JetHadronization", "toy_scale"});
+    id = GetXMLElementInt({"JetHadronization", "toy_id"});
+  }
+
+  void DoHadronization(vector<vector<shared_ptr<Parton>>> &pIn,
+                       vector<shared_ptr<Hadron>> &hOut,
+                       vector<shared_ptr<Parton>> &pOut) {
+    for (auto &shower : pIn)
+      for (auto &p : shower)
+        hOut.push_back(make_shared<Hadron>(
+            p->plabel(), id, 1,
+            FourVector(scale * p->px(), scale * p->py(), scale * p->pz(),
+                       scale * p->e()),
+            FourVector(0., 0., 0., 0.)));
+  }
+
+  double scale = 0.;
+  int id = 0;
+};
+
+// A Hadronization task with its module, set up as JetScape does for the
+// main run (empty name) and for each <Variant>
+shared_ptr<Hadronization> MakeTask(const std::string &variant,
+                                   shared_ptr<ToyHadronization> &module) {
+  auto task = make_shared<Hadronization>();
+  if (!variant.empty())
+    task->SetVariant(variant, JetScapeXML::Instance()
+                                  ->GetXMLRootUser()
+                                  ->FirstChildElement("JetHadronization")
+                                  ->FirstChildElement("Variants")
+                                  ->FirstChildElement("Variant"));
+  module = make_shared<ToyHadronization>();
+  task->Add(module);
+  task->TransformPartons.connect(module.get(),
+                                 &ToyHadronization::DoHadronization);
+  return task;
+}
+
+vector<vector<shared_ptr<Parton>>> ToyPartons() {
+  vector<vector<shared_ptr<Parton>>> partons(2);
+  for (int i = 0; i < 5; i++)
+    partons[i % 2].push_back(make_shared<Parton>(
+        i, 21, 0, FourVector(1. + i, 0.5, 10. - 3. * i, 11. + i),
+        FourVector(0., 0., 0., 0.)));
+  return partons;
+}
+
+} // namespace
+
+// the variant module sees its own parameter during Init only, and
+// hadronizes the same partons as the main run
+TEST(HadronizationVariantsTest, TEST_OVERRIDE_AND_SHARED_PARTONS){
+    OpenXML();
+    shared_ptr<ToyHadronization> main_module, half_module;
+    auto main_task = MakeTask("", main_module);
+    auto half_task = MakeTask("half", half_module);
+    main_task->Init();
+    half_task->Init();
+    EXPECT_DOUBLE_EQ(1., main_module->scale);
+    EXPECT_DOUBLE_EQ(0.5, half_module->scale);
+    // parameters the variant does not list come from the block itself
+    EXPECT_EQ(211, half_module->id);
+    // and the override ends with the Init of the variant
+    EXPECT_DOUBLE_EQ(
+        1., JetScapeXML::Instance()->GetElementDouble(
+                {"JetHadronization", "toy_scale"}));
+
+    auto partons = ToyPartons();
+    main_task->AddInPartons(partons);
+    half_task->AddInPartons(partons);
+    main_task->Exec();
+    half_task->Exec();
+    auto main_hadrons = main_task->GetHadrons();
+    auto half_hadrons = half_task->GetHadrons();
+    ASSERT_EQ(5u, main_hadrons.size());
+    ASSERT_EQ(main_hadrons.size(), half_hadrons.size());
+    for (unsigned int i = 0; i < main_hadrons.size(); i++) {
+      EXPECT_EQ(main_hadrons[i]->plabel(), half_hadrons[i]->plabel());
+      EXPECT_DOUBLE_EQ(0.5 * main_hadrons[i]->pz(), half_hadrons[i]->pz());
+    }
+
+    // the manager hands on and deletes the hadrons of the main run only
+    auto manager = make_shared<HadronizationManager>();
+    manager->Add(main_task);
+    manager->Add(half_task);
+    vector<shared_ptr<Hadron>> hadrons;
+    manager->GetHadrons(hadrons);
+    ASSERT_EQ(main_hadrons.size(), hadrons.size());
+    EXPECT_DOUBLE_EQ(main_hadrons[0]->pz(), hadrons[0]->pz());
+    manager->DeleteHadrons();
+    EXPECT_TRUE(main_task->GetHadrons().empty());
+    EXPECT_EQ(5u, half_task->GetHadrons().size());
+}
+
+// each task writes its hadrons to the writers of its own variant
+TEST(HadronizationVariantsTest, TEST_WRITERS){
+    OpenXML();
+    shared_ptr<ToyHadronization> main_module, half_module;
+    auto main_task = MakeTask("", main_module);
+    auto half_task = MakeTask("half", half_module);
+    main_task->Init();
+    half_task->Init();
+    main_task->AddInPartons(ToyPartons());
+    half_task->AddInPartons(ToyPartons());
+    main_task->Exec();
+    half_task->Exec();
+
+    const std::string variants[] = {"", "half"};
+    for (auto &variant : variants) {
+      std::string file_name = "hadronization_variants" + variant + ".dat";
+      auto writer = make_shared<JetScapeWriterAscii>(file_name);
+      writer->SetVariant(variant);
+      writer->Init();
+      JetScapeModuleBase::SetCurrentEvent(0);
+      writer->WriteHeaderToFile();
+      main_task->WriteTask(writer);
+      half_task->WriteTask(writer);
+      writer->Close();
+
+      auto reader = make_shared<JetScapeReaderAscii>(file_name);
+      reader->Next();
+      auto expected =
+          variant.empty() ? main_task->GetHadrons() : half_task->GetHadrons();
+      auto read = reader->GetHadrons();
+      ASSERT_EQ(expected.size(), read.size());
+      for (unsigned int i = 0; i < read.size(); i++)
+        EXPECT_NEAR(expected[i]->pz(), read[i]->pz(), 1e-4);
+      std::remove(file_name.c_str());
+    }
+}
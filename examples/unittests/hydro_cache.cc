@@ -0,0 +1,113 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "HydroCache.h"
+#include "gtest/gtest.h"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace Jetscape;
+
+namespace {
+
+EvolutionHistory MakeHistory(int n_cells, real ed) {
+    EvolutionHistory hist;
+    hist.tau_min = 0.6;
+    hist.dtau = 0.1;
+    hist.x_min = -1.;
+    hist.dx = 0.5;
+    hist.y_min = -1.;
+    hist.dy = 0.5;
+    hist.eta_min = 0.;
+    hist.deta = 0.1;
+    hist.ntau = n_cells;
+    hist.nx = 1;
+    hist.ny = 1;
+    hist.neta = 1;
+    hist.tau_eta_is_tz = false;
+    hist.boost_invariant = true;
+    for (int i = 0; i < n_cells; i++) {
+        FluidCellInfo cell;
+        cell.energy_density = ed * i;
+        hist.data.push_back(cell);
+    }
+    return hist;
+}
+
+} // end anonymous namespace
+
+TEST(HydroCacheTest, TEST_ROUND_TRIP){
+    std::string dir = "hydro_cache_test_round_trip";
+    std::filesystem::remove_all(dir);
+    HydroCache cache(dir, 1.);
+
+    HydroCacheDigest digest;
+    digest.Add(std::string("settings"));
+    std::string key = digest.Hex();
+    ASSERT_EQ(key.size(), 32u);
+
+    EvolutionHistory loaded;
+    std::vector<SurfaceCellInfo> surface;
+    EXPECT_FALSE(cache.Load(key, loaded, surface));
+
+    std::vector<SurfaceCellInfo> stored_surface(3);
+    stored_surface[1].temperature = 0.15;
+    cache.Store(key, MakeHistory(10, 2.), stored_surface);
+    ASSERT_TRUE(cache.Load(key, loaded, surface));
+    EXPECT_EQ(loaded.ntau, 10);
+    EXPECT_EQ(loaded.data.size(), 10u);
+    EXPECT_NEAR(loaded.data[3].energy_density, 6., 1e-6);
+    EXPECT_NEAR(loaded.dtau, 0.1, 1e-6);
+    ASSERT_EQ(surface.size(), 3u);
+    EXPECT_NEAR(surface[1].temperature, 0.15, 1e-6);
+
+    // a damaged entry is detected and removed
+    std::string path = dir + "/" + key + ".jshydro";
+    {
+        std::fstream f(path, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(-4, std::ios::end);
+        f.write("XXXX", 4);
+    }
+    EXPECT_FALSE(cache.Load(key, loaded, surface));
+    EXPECT_FALSE(std::filesystem::exists(path));
+    std::filesystem::remove_all(dir);
+}
+
+TEST(HydroCacheTest, TEST_EVICTION){
+    std::string dir = "hydro_cache_test_eviction";
+    std::filesystem::remove_all(dir);
+    // room for about two entries of 1000 cells
+    double entry_size = 1000. * sizeof(FluidCellInfo) + 1000.;
+    HydroCache cache(dir, 2.5 * entry_size / 1e9);
+
+    EvolutionHistory loaded;
+    std::vector<SurfaceCellInfo> surface;
+    std::vector<std::string> keys;
+    for (int i = 0; i < 3; i++) {
+        HydroCacheDigest digest;
+        digest.Add(&i, sizeof(i));
+        keys.push_back(digest.Hex());
+        cache.Store(keys.back(), MakeHistory(1000, 1.), surface);
+        // keep the modification times apart
+        auto path = std::filesystem::path(dir) / (keys.back() + ".jshydro");
+        std::filesystem::last_write_time(
+            path, std::filesystem::file_time_type::clock::now() +
+                      std::chrono::seconds(i));
+    }
+    EXPECT_FALSE(cache.Load(keys[0], loaded, surface));
+    EXPECT_TRUE(cache.Load(keys[2], loaded, surface));
+    std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,117 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "LBT.h"
+#include "gtest/gtest.h"
+
+#include <random>
+
+using namespace Jetscape;
+
+namespace {
+
+LBTMediumCache CacheAt(const double x[4], double cell_size, double dt) {
+  LBTMediumCache medium;
+  LBTMediumCache::Cell(x, cell_size, medium.cell);
+  medium.dt = dt;
+  medium.depth_per_step = 0.05;
+  medium.valid = true;
+  return medium;
+}
+
+// Steps until the first interaction of a parton moving along x through a
+// uniform medium of optical depth depth_per_step per step of length dt.
+// per_step: one draw per step, as LBT without event_driven. Otherwise the
+// depth to the next interaction is sampled once and the medium is only
+// evaluated in full when the cache does not cover the step; evaluations
+// counts those.
+int StepsToInteraction(std::mt19937 &rng, double depth_per_step, double dt,
+                       double cell_size, bool per_step, long &evaluations) {
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  double depth_left = -std::log(1.0 - uniform(rng));
+  LBTMediumCache medium;
+  for (int step = 1;; step++) {
+    double x[4] = {step * dt, step * dt, 0.0, 0.0};
+    if (per_step) {
+      evaluations++;
+      if (uniform(rng) < 1.0 - std::exp(-depth_per_step))
+        return step;
+      continue;
+    }
+    if (medium.Covers(x, cell_size, dt, -1) &&
+        depth_left - medium.depth_per_step > 0.0) {
+      depth_left -= medium.depth_per_step;
+      continue;
+    }
+    evaluations++;
+    depth_left -= depth_per_step;
+    if (depth_left <= 0.0)
+      return step;
+    medium = CacheAt(x, cell_size, dt);
+    medium.depth_per_step = depth_per_step;
+  }
+}
+
+} // namespace
+
+TEST(LBTEventDrivenTest, TEST_CACHE_COVERS){
+    const double x[4] = {1.05, 0.25, -0.05, 0.0};
+    LBTMediumCache medium;
+    EXPECT_FALSE(medium.Covers(x, 0.3, 0.1, -1));
+
+    medium = CacheAt(x, 0.3, 0.1);
+    EXPECT_EQ(3, medium.cell[0]);
+    EXPECT_EQ(-1, medium.cell[2]);
+    EXPECT_TRUE(medium.Covers(x, 0.3, 0.1, -1));
+
+    // a step within the cell, across its boundary, with another length
+    const double inside[4] = {1.15, 0.29, -0.29, 0.1};
+    const double outside[4] = {1.25, 0.31, -0.05, 0.0};
+    EXPECT_TRUE(medium.Covers(inside, 0.3, 0.1, -1));
+    EXPECT_FALSE(medium.Covers(outside, 0.3, 0.1, -1));
+    EXPECT_FALSE(medium.Covers(x, 0.3, 0.2, -1));
+
+    // the radiation table is piecewise constant in its time bins
+    medium.rad_time_bin = 4;
+    EXPECT_TRUE(medium.Covers(x, 0.3, 0.1, 4));
+    EXPECT_FALSE(medium.Covers(x, 0.3, 0.1, 5));
+}
+
+// In a uniform medium reusing the evaluation between interactions gives the
+// same distribution of the first interaction as one draw per step.
+TEST(LBTEventDrivenTest, TEST_UNIFORM_MEDIUM){
+    const double depth_per_step = 0.05, dt = 0.1, cell_size = 0.3;
+    const int n_partons = 200000;
+    std::mt19937 rng(12345);
+    for (bool per_step : {true, false}) {
+        long evaluations = 0, steps = 0, first = 0;
+        for (int i = 0; i < n_partons; i++) {
+            int n = StepsToInteraction(rng, depth_per_step, dt, cell_size,
+                                       per_step, evaluations);
+            steps += n;
+            if (n == 1) first++;
+        }
+        const double p = 1.0 - std::exp(-depth_per_step);
+        EXPECT_NEAR(1.0 / p, double(steps) / n_partons, 0.02 / p);
+        EXPECT_NEAR(p, double(first) / n_partons, 0.05 * p);
+        if (per_step) {
+            EXPECT_EQ(steps, evaluations);
+        } else {
+            // one evaluation per cell crossed plus the interaction itself
+            EXPECT_LT(evaluations, steps / 2);
+        }
+    }
+}
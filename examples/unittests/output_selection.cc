@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "gtest/gtest.h"
+#include "JetScapeOutputSelection.h"
+
+#include <cmath>
+
+using namespace Jetscape;
+
+// Hadron with the given transverse momentum (along x) and pseudorapidity
+static std::shared_ptr<Hadron> MakeHadron(int pid, int stat, double pt,
+                                          double eta) {
+  double pz = pt * std::sinh(eta);
+  double e = std::sqrt(pt * pt + pz * pz + 0.14 * 0.14);
+  return std::make_shared<Hadron>(Hadron(0, pid, stat, FourVector(pt, 0., pz, e),
+                                         FourVector(0., 0., 0., 0.)));
+}
+
+TEST(OutputSelectionTest, TEST_INACTIVE_ACCEPTS_ALL) {
+  JetScapeOutputSelection selection;
+  selection.SetPtRange(100., -1.);
+  EXPECT_FALSE(selection.IsActive());
+  EXPECT_TRUE(selection.Accept(*MakeHadron(211, 0, 1., 0.)));
+}
+
+TEST(OutputSelectionTest, TEST_KINEMATIC_CUTS) {
+  JetScapeOutputSelection selection;
+  selection.SetActive(true);
+  selection.SetPtRange(1., 10.);
+  selection.SetEtaMax(1.);
+
+  EXPECT_TRUE(selection.Accept(*MakeHadron(211, 0, 2., 0.5)));
+  EXPECT_TRUE(selection.Accept(*MakeHadron(211, 0, 2., -0.99)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(211, 0, 0.5, 0.)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(211, 0, 20., 0.)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(211, 0, 2., 1.01)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(211, 0, 2., -1.5)));
+}
+
+TEST(OutputSelectionTest, TEST_SPECIES_AND_STATUS) {
+  JetScapeOutputSelection selection;
+  selection.SetActive(true);
+  selection.SetPids({-211, 211, 2212});
+  selection.SetHoles(JetScapeOutputSelection::Drop);
+
+  EXPECT_TRUE(selection.Accept(*MakeHadron(-211, 0, 1., 0.)));
+  EXPECT_TRUE(selection.Accept(*MakeHadron(2212, 0, 1., 0.)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(321, 0, 1., 0.)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(211, -1, 1., 0.)));
+
+  selection.SetPids({});
+  selection.SetExcludedPids({111});
+  selection.SetHoles(JetScapeOutputSelection::Only);
+  EXPECT_TRUE(selection.Accept(*MakeHadron(211, -1, 1., 0.)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(111, -1, 1., 0.)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(211, 0, 1., 0.)));
+
+  selection.SetHoles(JetScapeOutputSelection::Keep);
+  selection.SetRecoils(JetScapeOutputSelection::Drop);
+  EXPECT_FALSE(selection.Accept(*MakeHadron(211, 1, 1., 0.)));
+  EXPECT_TRUE(selection.Accept(*MakeHadron(211, 0, 1., 0.)));
+}
+
+TEST(OutputSelectionTest, TEST_CHARGE) {
+  JetScapeOutputSelection selection;
+  selection.SetActive(true);
+  selection.SetCharge(JetScapeOutputSelection::Charged);
+  EXPECT_TRUE(selection.Accept(*MakeHadron(211, 0, 1., 0.)));
+  EXPECT_FALSE(selection.Accept(*MakeHadron(111, 0, 1., 0.)));
+
+  selection.SetCharge(JetScapeOutputSelection::Neutral);
+  EXPECT_FALSE(selection.Accept(*MakeHadron(-211, 0, 1., 0.)));
+  EXPECT_TRUE(selection.Accept(*MakeHadron(111, 0, 1., 0.)));
+}
+
+TEST(OutputSelectionTest, TEST_SELECT_KEEPS_ORDER) {
+  JetScapeOutputSelection selection;
+  selection.SetActive(true);
+  selection.SetPtRange(1., -1.);
+
+  std::vector<std::shared_ptr<Hadron>> hadrons;
+  for (int i = 0; i < 6; i++)
+    hadrons.push_back(MakeHadron(211, 0, 0.5 * i, 0.));
+  selection.Select(hadrons);
+
+  ASSERT_EQ(hadrons.size(), 4u);
+  for (unsigned int i = 0; i < hadrons.size(); i++)
+    EXPECT_NEAR(hadrons[i]->pt(), 0.5 * (i + 2), 1e-12);
+}
@@ -0,0 +1,219 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "JetScapeReader.h"
+#include "JetScapeWriterStream.h"
+#include "PartonShower.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Jetscape;
+
+namespace {
+
+const std::string file_name = "reader_roundtrip_test.dat";
+
+// The Ascii writer prints six significant digits
+void ExpectClose(double expected, double actual) {
+  EXPECT_NEAR(expected, actual, 1e-4 * std::max(1., std::fabs(expected)));
+}
+
+shared_ptr<Parton> MakeParton(int label, int pid, double px, double py,
+                              double pz) {
+  double e = std::sqrt(px * px + py * py + pz * pz);
+  return make_shared<Parton>(label, pid, 0, FourVector(px, py, pz, e),
+                             FourVector(0., 0., 0., 0.));
+}
+
+// A shower with a splitting and a rescattering, written with the same calls
+// as JetEnergyLoss and Hadronization use for their output
+void WriteEvents(const vector<vector<shared_ptr<Hadron>>> &hadrons,
+                 const vector<bool> &with_shower) {
+  JetScapeWriterAscii writer(file_name);
+  writer.Init();
+  for (unsigned int ev = 0; ev < hadrons.size(); ev++) {
+    JetScapeModuleBase::SetCurrentEvent(ev);
+    writer.GetHeader().SetSigmaGen(1.25e-3 * (ev + 1));
+    writer.GetHeader().SetEventWeight(0.5 + ev);
+    writer.WriteHeaderToFile();
+
+    if (with_shower[ev]) {
+      auto shower = make_shared<PartonShower>();
+      node v0 = shower->new_vertex(make_shared<Vertex>(0., 0., 0., 0.));
+      node v1 = shower->new_vertex(make_shared<Vertex>(0.1, -0.2, 0.3, 0.4));
+      node v2 = shower->new_vertex(make_shared<Vertex>(-1.5, 2e-7, 0., 1.0));
+      node v3 = shower->new_vertex(make_shared<Vertex>(0.5, 0., -3.25, 1.0));
+      node v4 = shower->new_vertex(make_shared<Vertex>(1., 1., 1., 2.0));
+      shower->new_parton(v0, v1, MakeParton(1, 21, 40., 5., -12.));
+      shower->new_parton(v1, v2, MakeParton(2, 1, 25., 2., -8.));
+      shower->new_parton(v1, v3, MakeParton(3, -1, 15., 3., -4.));
+      shower->new_parton(v2, v4, MakeParton(4, 1, 24.5, -2., -7.5));
+      writer.Write(weak_ptr<PartonShower>(shower));
+    }
+
+    for (unsigned int i = 0; i < hadrons[ev].size(); i++) {
+      writer.WriteWhiteSpace("[" + to_string(i) + "] H");
+      writer.Write(weak_ptr<Hadron>(hadrons[ev][i]));
+    }
+  }
+  writer.Close();
+}
+
+shared_ptr<Hadron> MakeHadron(int label, int pid, int stat, double px,
+                              double py, double pz) {
+  double e = std::sqrt(px * px + py * py + pz * pz + 0.14 * 0.14);
+  return make_shared<Hadron>(label, pid, stat, FourVector(px, py, pz, e),
+                             FourVector(0., 0., 0., 0.));
+}
+
+} // namespace
+
+// events written by the Ascii writer are read back, including an event
+// without any shower or hadron
+TEST(ReaderRoundTripTest, TEST_WRITER_OUTPUT){
+    vector<vector<shared_ptr<Hadron>>> hadrons(3);
+    hadrons[0].push_back(MakeHadron(0, 211, 811, 1.5, -0.3, 2.));
+    hadrons[0].push_back(MakeHadron(1, -321, -822, -0.2, 0.7, -150.));
+    hadrons[2].push_back(MakeHadron(0, 2212, 0, 1e-4, 3e-4, 5e2));
+    WriteEvents(hadrons, {true, false, true});
+
+    auto reader = make_shared<JetScapeReaderAscii>(file_name);
+    for (unsigned int ev = 0; ev < hadrons.size(); ev++) {
+      ASSERT_FALSE(reader->Finished());
+      reader->Next();
+      EXPECT_EQ((int)ev, reader->GetCurrentEvent());
+      ExpectClose(1.25e-3 * (ev + 1), reader->GetSigmaGen());
+      ExpectClose(0.5 + ev, reader->GetEventWeight());
+
+      // hadrons, from the records and as objects
+      ASSERT_EQ((int)hadrons[ev].size(), reader->GetNumberOfHadrons());
+      auto read = reader->GetHadrons();
+      auto forFJ = reader->GetHadronsForFastJet();
+      for (unsigned int i = 0; i < hadrons[ev].size(); i++) {
+        auto &h = hadrons[ev][i];
+        EXPECT_EQ(h->plabel(), read[i]->plabel());
+        EXPECT_EQ(h->pid(), read[i]->pid());
+        EXPECT_EQ(h->pstat(), read[i]->pstat());
+        ExpectClose(h->px(), read[i]->px());
+        ExpectClose(h->pz(), read[i]->pz());
+        ExpectClose(h->e(), read[i]->e());
+        ExpectClose(h->py(), forFJ[i].py());
+        ExpectClose(h->pz(), forFJ[i].pz());
+      }
+
+      // the shower as flat columns and as graph
+      auto &columns = reader->GetPartonShowerColumns();
+      ASSERT_EQ(1u, columns.size());
+      auto &c = columns[0];
+      if (ev == 1) {
+        EXPECT_EQ(0, c.GetNumberOfVertices());
+        EXPECT_EQ(0, c.GetNumberOfPartons());
+        continue;
+      }
+      EXPECT_EQ(5, c.GetNumberOfVertices());
+      ASSERT_EQ(4, c.GetNumberOfPartons());
+      EXPECT_EQ((vector<int>{-1, 0, 0, 1}), c.GetParentIndices());
+      EXPECT_EQ((vector<int>{2, 3}), c.GetFinalPartonIndices());
+      ExpectClose(-3.25, c.vz[3]);
+      ExpectClose(2e-7, c.vy[2]);
+      EXPECT_EQ(-1, c.pid[2]);
+
+      auto showers = reader->GetPartonShowers();
+      ASSERT_EQ(1u, showers.size());
+      EXPECT_EQ(4, showers[0]->GetNumberOfPartons());
+      for (int i = 0; i < c.GetNumberOfPartons(); i++) {
+        EXPECT_EQ(c.label[i], showers[0]->GetPartonAt(i)->plabel());
+        ExpectClose(c.e[i], showers[0]->GetPartonAt(i)->e());
+      }
+    }
+    EXPECT_TRUE(reader->Finished());
+}
+
+// hand-written lines with negative and exponent floats, lines cut short and
+// a last line without newline
+TEST(ReaderRoundTripTest, TEST_EDGE_CASES){
+    {
+      std::ofstream out(file_name);
+      out << "0 Event\n"
+          << "# JetScape writer sigmaGen 2.5E-02\n"
+          << "# JetScape writer EventPlaneAngle -1.0e+00\n"
+          << "[0] V 0 0 0 0\n"
+          << "[1] V -1e-3 2.5E+1 -0 1.5\n"
+          << "[0]=>[1] P 1 21 0 1.2e+02 -3.5e-01 -3.0 1.25e2 0 0 0 0\n"
+          << "[0]=>[1] P 2 21 0 50.\n"
+          << "[0]=>[7] P 3 21 0 1 2 3 4 0 0 0 0\n"
+          << "[0] H 0 211 -1 -0.0 -2.5e+00 3.1 4.5E-1 0 0 0 0\n"
+          << "[1] H 1 211 0 1.5\n"
+          << "\n"
+          << "1 Event\n"
+          << "[0] H 0 -211 0 1e-10 1E+1 -3.1 2e2 0 0 0 0";
+    }
+
+    auto reader = make_shared<JetScapeReaderAscii>(file_name);
+    reader->Next();
+    EXPECT_EQ(0, reader->GetCurrentEvent());
+    EXPECT_DOUBLE_EQ(2.5e-2, reader->GetSigmaGen());
+    EXPECT_DOUBLE_EQ(-1.0, reader->GetEventPlaneAngle());
+
+    // the truncated and the out of range parton lines are skipped
+    auto &c = reader->GetPartonShowerColumns()[0];
+    ASSERT_EQ(2, c.GetNumberOfVertices());
+    EXPECT_DOUBLE_EQ(-1e-3, c.vx[1]);
+    EXPECT_DOUBLE_EQ(25., c.vy[1]);
+    ASSERT_EQ(1, c.GetNumberOfPartons());
+    EXPECT_DOUBLE_EQ(120., c.pt[0]);
+    EXPECT_DOUBLE_EQ(-0.35, c.eta[0]);
+    EXPECT_DOUBLE_EQ(-3.0, c.phi[0]);
+    EXPECT_DOUBLE_EQ(125., c.e[0]);
+
+    // so is the truncated hadron line
+    ASSERT_EQ(1, reader->GetNumberOfHadrons());
+    auto forFJ = reader->GetHadronsForFastJet();
+    EXPECT_DOUBLE_EQ(0.45, forFJ[0].e());
+    EXPECT_EQ(-1, reader->GetHadrons()[0]->pstat());
+
+    // the last event ends without newline
+    ASSERT_FALSE(reader->Finished());
+    reader->Next();
+    EXPECT_EQ(1, reader->GetCurrentEvent());
+    ASSERT_EQ(1, reader->GetNumberOfHadrons());
+    forFJ = reader->GetHadronsForFastJet();
+    EXPECT_DOUBLE_EQ(200., forFJ[0].e());
+    EXPECT_DOUBLE_EQ(1e-10 * std::sinh(10.), forFJ[0].pz());
+    EXPECT_EQ(-211, reader->GetHadrons()[0]->pid());
+    EXPECT_TRUE(reader->Finished());
+}
+
+// in hadron-only mode no shower columns are filled
+TEST(ReaderRoundTripTest, TEST_HADRON_ONLY){
+    vector<vector<shared_ptr<Hadron>>> hadrons(1);
+    hadrons[0].push_back(MakeHadron(0, 211, 1, 1., 2., 3.));
+    WriteEvents(hadrons, {true});
+
+    auto reader = make_shared<JetScapeReaderAscii>(file_name);
+    reader->SetHadronOnly(true);
+    reader->Next();
+    EXPECT_EQ(0, reader->GetCurrentNumberOfPartonShowers());
+    EXPECT_TRUE(reader->GetPartonShowers().empty());
+    ASSERT_EQ(1, reader->GetNumberOfHadrons());
+    ExpectClose(3., reader->GetHadrons()[0]->pz());
+}
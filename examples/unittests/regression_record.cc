@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "JetScapeRegressionRecord.h"
+#include "JetScapeWriterRegression.h"
+#include "PartonShower.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Jetscape;
+
+namespace {
+
+const std::string golden = std::string(REGRESSION_GOLDEN_DIR) + "/toy_shower.dat";
+
+shared_ptr<Parton> Gluon(int label, double px, double pz, double t,
+                         const std::string &module = "") {
+  double e = std::sqrt(px * px + pz * pz) + 0.5;
+  auto p = make_shared<Parton>(label, 21, 0, FourVector(px, 0., pz, e),
+                               FourVector(0., 0., 0., t));
+  if (!module.empty())
+    p->SetController(module);
+  return p;
+}
+
+// A hard parton and a shower in which Matter splits the initiating gluon
+// and Lbt scatters one of the daughters.
+void WriteToyEvent(const std::string &file_name) {
+  auto shower = make_shared<PartonShower>();
+  node v0 = shower->new_vertex(make_shared<Vertex>(0., 0., 0., 0.));
+  node v1 = shower->new_vertex(make_shared<Vertex>(0., 0., 0., 0.1));
+  node v2 = shower->new_vertex(make_shared<Vertex>(0., 0., 0., 0.6));
+  node v3 = shower->new_vertex(make_shared<Vertex>(0., 0., 0., 0.6));
+  node v4 = shower->new_vertex(make_shared<Vertex>(0., 0., 0., 1.1));
+  auto initiating = Gluon(1, 30., 10., 0.);
+  shower->new_parton(v0, v1, make_shared<Parton>(*initiating));
+  shower->new_parton(v1, v2, Gluon(2, 20., 7., 0.1, "Matter"));
+  shower->new_parton(v1, v3, Gluon(3, 10., 3., 0.1, "Matter"));
+  shower->new_parton(v2, v4, Gluon(4, 19.25, 6.5, 0.6, "Lbt"));
+
+  JetScapeWriterRegression writer(file_name);
+  writer.Init();
+  writer.WriteHeaderToFile();
+  writer.WriteComment("HardProcess Parton List: PythiaGun");
+  writer.Write(weak_ptr<Parton>(initiating));
+  writer.WriteComment("Energy loss Shower Initating Parton: JetEnergyLoss");
+  writer.Write(weak_ptr<Parton>(initiating));
+  writer.Write(weak_ptr<PartonShower>(shower));
+  writer.Close();
+}
+
+} // namespace
+
+// shower partons are written in sections of the module that produced them
+TEST(RegressionRecordTest, TEST_MODULE_SECTIONS){
+    WriteToyEvent("regression_record_test.dat");
+    std::vector<RegressionEvent> events;
+    std::string error;
+    ASSERT_TRUE(ReadRegressionFile("regression_record_test.dat", events, error))
+        << error;
+    ASSERT_EQ(1u, events.size());
+    const auto &sections = events[0].sections;
+    ASSERT_EQ(4u, sections.size());
+    EXPECT_EQ("Hard:PythiaGun", sections[0].module);
+    EXPECT_EQ("Shower:JetEnergyLoss", sections[1].module);
+    EXPECT_EQ("Eloss:Matter", sections[2].module);
+    EXPECT_EQ("Eloss:Lbt", sections[3].module);
+    // initiating parton, five vertices and the unclaimed root edge
+    EXPECT_EQ(7u, sections[1].records.size());
+    EXPECT_EQ(2u, sections[2].records.size());
+    EXPECT_EQ(1u, sections[3].records.size());
+}
+
+// the record is bitwise stable against the committed reference
+TEST(RegressionRecordTest, TEST_GOLDEN){
+    WriteToyEvent("regression_record_test.dat");
+    std::vector<RegressionEvent> reference, candidate;
+    std::string error;
+    ASSERT_TRUE(ReadRegressionFile(golden, reference, error)) << error;
+    ASSERT_TRUE(ReadRegressionFile("regression_record_test.dat", candidate,
+                                   error)) << error;
+    JetScapeRegressionComparison comparison;
+    EXPECT_TRUE(comparison.Compare(reference, candidate));
+}
+
+// a change of an Lbt parton is blamed on Lbt, not on the shower as a whole
+TEST(RegressionRecordTest, TEST_ATTRIBUTION){
+    std::vector<RegressionEvent> reference, candidate;
+    std::string error;
+    ASSERT_TRUE(ReadRegressionFile(golden, reference, error)) << error;
+    candidate = reference;
+    double &px = candidate[0].sections[3].records[0].reals[0];
+    px *= 1. + 1e-12;
+
+    JetScapeRegressionComparison bitwise;
+    EXPECT_FALSE(bitwise.Compare(reference, candidate));
+    ASSERT_EQ(1u, bitwise.GetFirstDifferences().size());
+    EXPECT_EQ("Eloss:Lbt", bitwise.GetFirstDifferences().begin()->first);
+
+    JetScapeRegressionComparison tolerant;
+    tolerant.SetTolerance("Lbt", 1e-10);
+    EXPECT_TRUE(tolerant.Compare(reference, candidate));
+    tolerant.SetTolerance("Lbt", 0.);
+    tolerant.SetTolerance("Matter", 1e-10);
+    EXPECT_FALSE(tolerant.Compare(reference, candidate));
+}
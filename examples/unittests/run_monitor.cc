@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "JetScapeRunMonitor.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+using namespace Jetscape;
+
+namespace {
+
+std::shared_ptr<Hadron> MakeHadron(double pt, double eta, int stat = 0) {
+  double x[4] = {0., 0., 0., 0.};
+  return std::make_shared<Hadron>(0, 211, stat, pt, eta, 0., pt * std::cosh(eta),
+                                  x);
+}
+
+} // namespace
+
+TEST(RunMonitorTest, TEST_BINNING_AND_ERROR) {
+  JetScapeRunMonitor monitor;
+  monitor.SetPtBinEdges({10., 20., 40.});
+  monitor.SetEtaMax(1.);
+  ASSERT_EQ(monitor.GetNumberOfBins(), 2u);
+
+  // Event 1: one hadron per bin, one outside eta, one below the first edge
+  monitor.Fill({MakeHadron(15., 0.), MakeHadron(25., 0.5),
+                MakeHadron(15., 2.), MakeHadron(5., 0.)},
+               2.);
+  // Event 2: two hadrons in the low bin and a hole that cancels one of them
+  monitor.Fill({MakeHadron(12., 0.), MakeHadron(18., 0.),
+                MakeHadron(11., 0., -1)},
+               2.);
+
+  EXPECT_DOUBLE_EQ(monitor.GetYield(0), 4.);
+  EXPECT_DOUBLE_EQ(monitor.GetYield(1), 2.);
+  // Bin 0: y = {2, 2} -> no spread
+  EXPECT_DOUBLE_EQ(monitor.GetRelativeError(0), 0.);
+  // Bin 1: y = {2, 0} -> sigma^2 = 4 - 4/2 = 2
+  EXPECT_DOUBLE_EQ(monitor.GetRelativeError(1), std::sqrt(2.) / 2.);
+}
+
+TEST(RunMonitorTest, TEST_STOP_CRITERIA) {
+  JetScapeRunMonitor monitor;
+  monitor.SetPtBinEdges({10., 20.});
+  monitor.SetTargetRelativeError(0.1);
+  monitor.SetMinEvents(10);
+  monitor.Start();
+
+  // Alternate between one and two hadrons per event
+  int n = 0;
+  while (!monitor.ShouldStop()) {
+    std::vector<std::shared_ptr<Hadron>> hadrons(1 + n % 2,
+                                                 MakeHadron(15., 0.));
+    monitor.Fill(hadrons, 1.);
+    n++;
+    ASSERT_LT(n, 1000);
+  }
+  EXPECT_GE(n, 10);
+  EXPECT_LE(monitor.GetMaxRelativeError(), 0.1);
+  EXPECT_FALSE(monitor.GetStopReason().empty());
+
+  // Wall-time budget alone
+  JetScapeRunMonitor timed;
+  timed.SetMaxWallTime(1e-9);
+  timed.Start();
+  EXPECT_FALSE(timed.ShouldStop());
+  timed.Fill({}, 1.);
+  EXPECT_TRUE(timed.ShouldStop());
+}
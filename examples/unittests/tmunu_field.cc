@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "TmunuField.h"
+#include "gtest/gtest.h"
+
+using namespace Jetscape;
+
+// each component is its own vector, written in place, and a new event
+// reuses the storage of the previous one
+TEST(TmunuFieldTest, TEST_COMPONENTS){
+    TmunuField tmunu;
+    tmunu.Allocate(3);
+    ASSERT_EQ(3u, tmunu.size());
+    for (int c = 0; c < TmunuField::NUM_COMPONENTS; c++) {
+        auto &component = tmunu[TmunuField::Component(c)];
+        ASSERT_EQ(3u, component.size());
+        for (auto &value : component) value = 10 * c;
+        component[1] += 1;
+    }
+    const TmunuField &field = tmunu;
+    EXPECT_EQ(10 * TmunuField::PI00 + 1, field[TmunuField::PI00][1]);
+    EXPECT_EQ(10 * TmunuField::BULK_PI, field[TmunuField::BULK_PI][2]);
+
+    const double *pi33 = tmunu[TmunuField::PI33].data();
+    tmunu.clear();
+    EXPECT_EQ(0u, tmunu.size());
+    tmunu.Allocate(2);
+    EXPECT_EQ(pi33, tmunu[TmunuField::PI33].data());
+    EXPECT_EQ(0., tmunu[TmunuField::PI33][1]);
+}
+
+TEST(TmunuFieldTest, TEST_IDEAL_FLUID){
+    TmunuField tmunu;
+    tmunu.Allocate(5);
+    tmunu[TmunuField::PI12][4] = 1.;
+    tmunu.FillIdealFluidAtRest({3., 6.});
+    ASSERT_EQ(2u, tmunu.size());
+    const TmunuField &field = tmunu;
+    EXPECT_DOUBLE_EQ(6., field[TmunuField::E][1]);
+    EXPECT_DOUBLE_EQ(2., field[TmunuField::P][1]);
+    EXPECT_DOUBLE_EQ(1., field[TmunuField::UTAU][0]);
+    for (int c = TmunuField::UX; c < TmunuField::NUM_COMPONENTS; c++) {
+        for (auto value : field[TmunuField::Component(c)]) {
+            EXPECT_EQ(0., value);
+        }
+    }
+    tmunu.clear();
+    EXPECT_EQ(0u, tmunu.size());
+}
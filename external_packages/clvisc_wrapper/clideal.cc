@@ -172,6 +172,21 @@ void CLIdeal::read_ini(const std::vector<ValueType> & ed,
     initialize_gpu_buffer_();
 }
 
+// read initial ed and u^{mu} arrays, v^i = u^i / u^tau
+void CLIdeal::read_ini(size_t cells, const double * ed, const double * utau,
+                       const double * ux, const double * uy, const double * ueta)
+{
+    h_ev_.clear();
+    h_ev_.reserve(cells);
+    for (size_t idx = 0; idx < cells; idx++) {
+        h_ev_.push_back((cl_real4){{static_cast<cl_real>(ed[idx]), \
+                                   static_cast<cl_real>(ux[idx] / utau[idx]), \
+                                   static_cast<cl_real>(uy[idx] / utau[idx]), \
+                                   static_cast<cl_real>(ueta[idx] / utau[idx])}});
+    }
+    initialize_gpu_buffer_();
+}
+
 
 // step update for Runge-Kutta method, step = {1, 2}
 void CLIdeal::half_step_(int step) {
@@ -26,6 +26,7 @@
 #include <ctime>
 #include<cstdlib>
 #include <algorithm>
+#include <stdexcept>
 #include "include/clvisc.h"
 #include "include/error_msgs.h"
 
@@ -308,6 +309,26 @@ void CLVisc::read_ini(const std::vector<ValueType> & ed,
 }
 
 
+void CLVisc::read_ini(size_t cells, const double * ed, const double * utau,
+                      const double * ux, const double * uy, const double * ueta,
+                      const double * const * pi) {
+    if (cells < size_) {
+        throw std::out_of_range("CLVisc::read_ini: fewer cells than the grid");
+    }
+    ideal_.read_ini(cells, ed, utau, ux, uy, ueta);
+    h_shear_pi_.clear();
+    h_shear_pi_.reserve(10*size_);
+    for (size_t i = 0; i < size_; i++) {
+        for (size_t k = 0; k < 10; k++) {
+            h_shear_pi_.push_back(static_cast<cl_real>(pi[k][i]));
+        }
+    }
+    h_bulk_pi_ = std::vector<cl_real> (size_, 0.0);
+    cl_real4 zero4 = (cl_real4){{0.0, 0.0, 0.0, 0.0}};
+    h_net_charge_ = std::vector<cl_real4> (size_, zero4);
+    initialize_gpu_buffer_();
+}
+
 
 
 void CLVisc::evolve() {
@@ -128,6 +128,11 @@ class CLIdeal
                   const std::vector<ValueType> & vy, 
                   const std::vector<ValueType> & vz);
 
+    // read initial ed and the four-velocity u^tau, u^x, u^y, u^eta
+    // from arrays of length cells, without copying them first
+    void read_ini(size_t cells, const double * ed, const double * utau,
+                  const double * ux, const double * uy, const double * ueta);
+
     // run hydrodynamic evolution for one time step
     void one_step();
 
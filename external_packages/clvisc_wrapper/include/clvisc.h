@@ -141,6 +141,13 @@ class CLVisc
                   const std::vector<ValueType> & pi23,
                   const std::vector<ValueType> & pi33);
 
+    // read initial ed, u^tau, u^x, u^y, u^eta and shear viscosity from
+    // arrays of length cells, without copying them first; pi points to
+    // the ten arrays pi00, pi01, ..., pi33
+    void read_ini(size_t cells, const double * ed, const double * utau,
+                  const double * ux, const double * uy, const double * ueta,
+                  const double * const * pi);
+
     // read initial ed, vx, vy, vz vector and shear viscosity,
     // bulk viscosity and charge current
     template <typename ValueType>
@@ -0,0 +1,120 @@
+// TRENTO: Reduced Thickness Event-by-event Nuclear Topology
+// Copyright 2015 Jonah E. Bernhard, J. Scott Moreland
+// TRENTO3D: Three-dimensional extension of TRENTO by Weiyao Ke
+// MIT License
+
+#ifndef CELL_LIST_H
+#define CELL_LIST_H
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace trento {
+
+/// \rst
+/// Cell list for finding all points within a fixed range of a given position,
+/// in two (transverse) or three dimensions.  Space is divided into cubic cells
+/// of side ``range``, so every point within ``range`` lies in the same or an
+/// adjacent cell.  Cells are folded periodically onto a fixed number of buckets,
+/// so no bounding box is needed; folding only adds far-away candidates, which
+/// the caller removes with its exact distance test.
+///
+/// Example::
+///
+///   CellList cells{max_range, 2};
+///   cells.insert(0, x0, y0);
+///   cells.insert(1, x1, y1);
+///   cells.for_each_candidate(x, y, 0., [](std::size_t i) { ... });
+///
+/// \endrst
+class CellList {
+ public:
+  /// \param range maximum distance of the neighbor queries
+  /// \param dims 2 (ignore z) or 3
+  CellList(double range, int dims);
+
+  /// Remove all points, keeping the storage.
+  void clear();
+
+  /// Add point \c index at the given position.
+  void insert(std::size_t index, double x, double y, double z = 0.);
+
+  /// Call \c f(index) for every point in the cells around the position.  The
+  /// candidates include all points within \c range, in no particular order.
+  template <typename F>
+  void for_each_candidate(double x, double y, double z, F&& f) const;
+
+ private:
+  /// Number of buckets per dimension, a power of two.
+  static constexpr long nbuckets = 16;
+
+  /// Integer cell coordinate.
+  long cell(double x) const;
+
+  /// Bucket of a cell.
+  std::size_t bucket(long ix, long iy, long iz) const;
+
+  /// Inverse cell size, slightly smaller than 1/range to be safe against
+  /// rounding at the cell edges.
+  const double inv_size_;
+
+  const int dims_;
+
+  /// Linked lists of points: first point in each bucket, next point of each
+  /// point (-1 terminates).
+  std::vector<long> head_, next_;
+
+  /// Buckets in use, for clearing.
+  std::vector<std::size_t> used_;
+};
+
+inline CellList::CellList(double range, int dims)
+    : inv_size_(1./(range*(1. + 1e-9))),
+      dims_(dims),
+      head_(dims == 3 ? nbuckets*nbuckets*nbuckets : nbuckets*nbuckets, -1)
+{}
+
+inline void CellList::clear() {
+  for (auto b : used_)
+    head_[b] = -1;
+  used_.clear();
+}
+
+inline long CellList::cell(double x) const {
+  return static_cast<long>(std::floor(x*inv_size_));
+}
+
+inline std::size_t CellList::bucket(long ix, long iy, long iz) const {
+  // Two's complement '&' folds negative cells too.
+  auto b = static_cast<std::size_t>(((iy & (nbuckets-1)) * nbuckets) +
+                                    (ix & (nbuckets-1)));
+  if (dims_ == 3)
+    b += static_cast<std::size_t>((iz & (nbuckets-1)) * nbuckets*nbuckets);
+  return b;
+}
+
+inline void CellList::insert(std::size_t index, double x, double y, double z) {
+  if (next_.size() <= index)
+    next_.resize(index + 1, -1);
+  auto b = bucket(cell(x), cell(y), dims_ == 3 ? cell(z) : 0);
+  if (head_[b] < 0)
+    used_.push_back(b);
+  next_[index] = head_[b];
+  head_[b] = static_cast<long>(index);
+}
+
+template <typename F>
+void CellList::for_each_candidate(double x, double y, double z, F&& f) const {
+  const long ix = cell(x), iy = cell(y), iz = dims_ == 3 ? cell(z) : 0;
+  const long dz = dims_ == 3 ? 1 : 0;
+  for (long kz = iz - dz; kz <= iz + dz; ++kz)
+    for (long ky = iy - 1; ky <= iy + 1; ++ky)
+      for (long kx = ix - 1; kx <= ix + 1; ++kx)
+        for (long i = head_[bucket(kx, ky, kz)]; i >= 0; i = next_[i])
+          f(static_cast<std::size_t>(i));
+}
+
+}  // namespace trento
+
+#endif  // CELL_LIST_H
@@ -5,6 +5,7 @@
 
 #include "collider.h"
 
+#include <algorithm>
 #include <cmath>
 #include <string>
 #include <vector>
@@ -73,7 +74,8 @@ Collider::Collider(const VarMap& var_map)
       asymmetry_(determine_asym(*nucleusA_, *nucleusB_)),
       event_(var_map),
       output_(var_map),
-      with_ncoll_(var_map["ncoll"].as<bool>())
+      with_ncoll_(var_map["ncoll"].as<bool>()),
+      cellsB_(nucleon_profile_.max_impact(), 2)
 {
   // Constructor body begins here.
   // Set random seed if requested.
@@ -136,9 +138,23 @@ double Collider::sample_impact_param() {
     nucleusA_->sample_nucleons(asymmetry_ * b);
     nucleusB_->sample_nucleons((asymmetry_ - 1.) * b);
 
-    // Check each nucleon-nucleon pair.
+    // Check each nucleon-nucleon pair within the maximum impact parameter.
+    // Pairs further apart never collide and draw no random number, so
+    // visiting the candidates of each A in the order of B gives the same
+    // participants and collisions as looping over all pairs.
+    cellsB_.clear();
+    auto beginB = nucleusB_->begin();
+    for (auto B = beginB; B != nucleusB_->end(); ++B)
+      cellsB_.insert(B - beginB, B->x(), B->y());
+
     for (auto&& A : *nucleusA_) {
-      for (auto&& B : *nucleusB_) {
+      candidates_.clear();
+      cellsB_.for_each_candidate(A.x(), A.y(), 0.,
+        [this](std::size_t i) { candidates_.push_back(i); });
+      std::sort(candidates_.begin(), candidates_.end());
+
+      for (auto i : candidates_) {
+        auto&& B = *(beginB + i);
 		bool AB_collide = nucleon_profile_.participate(A, B);
 
         if (with_ncoll_) {
@@ -7,7 +7,9 @@
 #define COLLIDER_H
 
 #include <memory>
+#include <vector>
 
+#include "cell_list.h"
 #include "fwd_decl.h"
 #include "event.h"
 #include "nucleon.h"
@@ -110,6 +112,11 @@ class Collider {
   /// Whether calculate Ncoll and nulear binary collision density
   bool with_ncoll_;
 
+  /// Nucleons of B in transverse cells of the maximum impact parameter, and
+  /// the candidate partners of one nucleon of A.
+  CellList cellsB_;
+  std::vector<std::size_t> candidates_;
+
   // take down id, b, npart, ncoll, mult for each event.
   std::vector<records> all_records_;
 };
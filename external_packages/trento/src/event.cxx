@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <thread>
 
 #include <boost/program_options/variables_map.hpp>
 #include "nucleus.h"
@@ -69,13 +70,17 @@ Event::Event(const VarMap& var_map)
       xymax_(.5*nsteps_*dxy_),
       etamax_(var_map["eta-max"].as<double>()),
       eta2y_(var_map["jacobian"].as<double>(), etamax_, deta_),
+      nthreads_(var_map["threads"].as<int>() > 0
+                    ? var_map["threads"].as<int>()
+                    : std::max(1u, std::thread::hardware_concurrency())),
       cgf_(),
       TA_(boost::extents[nsteps_][nsteps_]),
       TB_(boost::extents[nsteps_][nsteps_]),
       TR_(boost::extents[nsteps_][nsteps_][1]),
 	  TAB_(boost::extents[nsteps_][nsteps_]),
       with_ncoll_(var_map["ncoll"].as<bool>()),
-      density_(boost::extents[nsteps_][nsteps_][neta_]) {
+      density_(boost::extents[nsteps_][nsteps_][neta_]),
+      dxsq_(nsteps_), dxsqB_(nsteps_), kernel_x_(nsteps_) {
   // Check if the skew parameter is within the applicable range
   // For 1: relative skew, skew_coeff_ < 10.
   //	 2: absolute skew, skew_coeff_ < 3.
@@ -172,21 +177,40 @@ void Event::accumulate_TAB(Nucleon& A, Nucleon& B, NucleonProfile& profile){
     int iymax = clip(static_cast<int>((y+r)/dxy_), 0, nsteps_-1);
 
     // Add Tpp to Ncoll density.
-	auto norm_Tpp = profile.norm_Tpp(bpp_sq);
+    // The Ncoll density does not fluctuates, so we use the
+    // deterministic thickness where the Gamma fluctuation are turned off.
+    // since this binary collision already happened, the binary collision
+    // density should be normalized to one.
+    // Both Gaussians factorize in x and y, so the product of the x (y)
+    // factors of A and B is tabulated once per column (row).
+    const double rsq = profile.radius_sqr();
+    const int nx = ixmax - ixmin + 1;
+    for (int i = 0; i < nx; ++i) {
+      double xc = (static_cast<double>(ixmin + i)+.5)*dxy_;
+      dxsq_[i] = (xA - xc)*(xA - xc);
+      dxsqB_[i] = (xB - xc)*(xB - xc);
+      kernel_x_[i] = profile.gaussian_factor(dxsq_[i])
+                     * profile.gaussian_factor(dxsqB_[i]);
+    }
+    const double prefactor = profile.deterministic_prefactor()
+                             * profile.deterministic_prefactor()
+                             / profile.norm_Tpp(bpp_sq);
     for (auto iy = iymin; iy <= iymax; ++iy) {
-      double dysqA = std::pow(yA - (static_cast<double>(iy)+.5)*dxy_, 2);
-	  double dysqB = std::pow(yB - (static_cast<double>(iy)+.5)*dxy_, 2);
-      for (auto ix = ixmin; ix <= ixmax; ++ix) {
-        double dxsqA = std::pow(xA - (static_cast<double>(ix)+.5)*dxy_, 2);
-		double dxsqB = std::pow(xB - (static_cast<double>(ix)+.5)*dxy_, 2);
-		// The Ncoll density does not fluctuates, so we use the 
-		// deterministic_thickness function
-		// where the Gamma fluctuation are turned off.
-		// since this binary collision already happened, the binary collision
-		// density should be normalized to one.
-        TAB_[iy][ix] += profile.deterministic_thickness(dxsqA + dysqA)
-						* profile.deterministic_thickness(dxsqB + dysqB)
-						/ norm_Tpp;
+      double yc = (static_cast<double>(iy)+.5)*dxy_;
+      double dysqA = (yA - yc)*(yA - yc);
+      double dysqB = (yB - yc)*(yB - yc);
+      // remaining squared distance along x within the truncation radius
+      double remA = rsq - dysqA, remB = rsq - dysqB;
+      if (remA < 0. || remB < 0.)
+        continue;
+      double ky = prefactor * profile.gaussian_factor(dysqA)
+                  * profile.gaussian_factor(dysqB);
+      double* row = &TAB_[iy][ixmin];
+      const double* dxsqA = dxsq_.data();
+      const double* dxsqB = dxsqB_.data();
+      const double* kx = kernel_x_.data();
+      for (int i = 0; i < nx; ++i) {
+        row[i] += (dxsqA[i] <= remA && dxsqB[i] <= remB) ? ky*kx[i] : 0.;
       }
     }
 }
@@ -204,6 +228,7 @@ void Event::compute_nuclear_thickness(
   std::fill(TX.origin(), TX.origin() + TX.num_elements(), 0.);
 
   const double r = profile.radius();
+  const double rsq = profile.radius_sqr();
 
   // Deposit each participant onto the grid.
   for (const auto& nucleon : nucleus) {
@@ -225,12 +250,27 @@ void Event::compute_nuclear_thickness(
     // Prepare profile for new nucleon.
     profile.fluctuate();
 
-    // Add profile to grid.
+    // Add profile to grid.  The Gaussian factorizes, so the exponential is
+    // only evaluated along the x and y edges of the subgrid, and every row
+    // is a scaled copy of the x kernel.  The truncation radius is applied
+    // per cell as before.
+    const int nx = ixmax - ixmin + 1;
+    for (int i = 0; i < nx; ++i) {
+      double dx = x - (static_cast<double>(ixmin + i)+.5)*dxy_;
+      dxsq_[i] = dx*dx;
+      kernel_x_[i] = profile.gaussian_factor(dxsq_[i]);
+    }
     for (auto iy = iymin; iy <= iymax; ++iy) {
-      double dysq = std::pow(y - (static_cast<double>(iy)+.5)*dxy_, 2);
-      for (auto ix = ixmin; ix <= ixmax; ++ix) {
-        double dxsq = std::pow(x - (static_cast<double>(ix)+.5)*dxy_, 2);
-        TX[iy][ix] += profile.thickness(dxsq + dysq);
+      double dy = y - (static_cast<double>(iy)+.5)*dxy_;
+      double rem = rsq - dy*dy;
+      if (rem < 0.)
+        continue;
+      double ky = profile.prefactor() * profile.gaussian_factor(dy*dy);
+      double* row = &TX[iy][ixmin];
+      const double* dxsq = dxsq_.data();
+      const double* kx = kernel_x_.data();
+      for (int i = 0; i < nx; ++i) {
+        row[i] += (dxsq[i] <= rem) ? ky*kx[i] : 0.;
       }
     }
   }
@@ -249,22 +289,6 @@ void Event::compute_reduced_thickness(GenMean gen_mean) {
       auto t = norm_ * gen_mean(ta, tb);
       /// At midrapidity    
       TR_[iy][ix][0] = t;
-      /// If operating in the 3D mode, the 3D density_ array is filled with
-      /// its value at eta=0 identical to TR_ array
-      if (is3D()) {
-        auto mean = mean_coeff_ * mean_function(ta, tb, exp_ybeam_);
-        auto std = std_coeff_ * std_function(ta, tb);
-        auto skew = skew_coeff_ * skew_function(ta, tb, skew_type_);
-        cgf_.calculate_dsdy(mean, std, skew);
-        auto mid_norm = cgf_.interp_dsdy(0.)*eta2y_.Jacobian(0.);
-        for (int ieta = 0; ieta < neta_; ++ieta) {
-          auto eta = -etamax_ + ieta*deta_;
-          auto rapidity = eta2y_.rapidity(eta);
-          auto jacobian = eta2y_.Jacobian(eta);
-          auto rapidity_dist = cgf_.interp_dsdy(rapidity);
-          density_[iy][ix][ieta] = t * rapidity_dist / mid_norm * jacobian;
-        }
-      }
 
       sum += t;
       // Center of mass grid indices.
@@ -277,6 +301,59 @@ void Event::compute_reduced_thickness(GenMean gen_mean) {
   multiplicity_ = dxy_ * dxy_ * sum;
   ixcm_ = ixcm / sum;
   iycm_ = iycm / sum;
+
+  /// If operating in the 3D mode, the 3D density_ array is filled with
+  /// its value at eta=0 identical to TR_ array
+  if (is3D())
+    compute_density();
+}
+
+void Event::compute_density() {
+  // Every transverse cell needs its own FFT of the rapidity profile, but the
+  // cells are independent.  Each thread fills a block of rows with its own
+  // cumulant_generating, so the result does not depend on the threads.
+  int nthreads = std::min(nthreads_, nsteps_);
+  if (nthreads <= 1) {
+    compute_density_rows(0, nsteps_, cgf_);
+    return;
+  }
+
+  std::vector<cumulant_generating> cgfs(nthreads);
+  std::vector<std::thread> threads;
+  int rows = (nsteps_ + nthreads - 1) / nthreads;
+  for (int i = 0; i < nthreads; ++i) {
+    int iymin = i * rows;
+    int iymax = std::min(nsteps_, iymin + rows);
+    if (iymin >= iymax)
+      break;
+    threads.emplace_back(&Event::compute_density_rows, this, iymin, iymax,
+                         std::ref(cgfs[i]));
+  }
+  for (auto& thread : threads)
+    thread.join();
+}
+
+void Event::compute_density_rows(int iymin, int iymax,
+                                 cumulant_generating& cgf) {
+  for (int iy = iymin; iy < iymax; ++iy) {
+    for (int ix = 0; ix < nsteps_; ++ix) {
+      auto ta = TA_[iy][ix];
+      auto tb = TB_[iy][ix];
+      auto t = TR_[iy][ix][0];
+      auto mean = mean_coeff_ * mean_function(ta, tb, exp_ybeam_);
+      auto std = std_coeff_ * std_function(ta, tb);
+      auto skew = skew_coeff_ * skew_function(ta, tb, skew_type_);
+      cgf.calculate_dsdy(mean, std, skew);
+      auto mid_norm = cgf.interp_dsdy(0.)*eta2y_.Jacobian(0.);
+      for (int ieta = 0; ieta < neta_; ++ieta) {
+        auto eta = -etamax_ + ieta*deta_;
+        auto rapidity = eta2y_.rapidity(eta);
+        auto jacobian = eta2y_.Jacobian(eta);
+        auto rapidity_dist = cgf.interp_dsdy(rapidity);
+        density_[iy][ix][ieta] = t * rapidity_dist / mid_norm * jacobian;
+      }
+    }
+  }
 }
 
 void Event::compute_observables() {
@@ -348,15 +425,15 @@ void Event::compute_observables() {
       e2.wt += t * r2;
 
       e3.re += t * (x3 - 3.*x*y2);
-      e3.im += t * y*(3. - 4.*y2);
+      e3.im += t * (3.*x2*y - y3);
       e3.wt += t * r2*r;
 
       e4.re += t * (x4 + y4 - 6.*x2y2);
-      e4.im += t * 4.*xy*(1. - 2.*y2);
+      e4.im += t * 4.*xy*(x2 - y2);
       e4.wt += t * r4;
 
-      e5.re += t * x*(x4 - 10.*x2y2 - 5.*y4);
-      e5.im += t * y*(1. - 12.*x2 + 16.*x4);
+      e5.re += t * x*(x4 - 10.*x2y2 + 5.*y4);
+      e5.im += t * y*(5.*x4 - 10.*x2y2 + y4);
       e5.wt += t * r4*r;
     }
   }
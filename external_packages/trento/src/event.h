@@ -8,6 +8,7 @@
 
 #include <functional>
 #include <map>
+#include <vector>
 
 #ifdef NDEBUG
 #define BOOST_DISABLE_ASSERTS
@@ -141,6 +142,13 @@ class Event {
   /// single "virtual" function call per event.
   std::function<void()> compute_reduced_thickness_;
 
+  /// Fill the 3D density from TA, TB and TR at midrapidity, in parallel over
+  /// transverse rows.
+  void compute_density();
+
+  /// Fill the rows [iymin, iymax) of the 3D density.
+  void compute_density_rows(int iymin, int iymax, cumulant_generating& cgf);
+
   /// Compute observables that require a second pass over the reduced thickness grid.
   void compute_observables();
 
@@ -169,6 +177,9 @@ class Event {
   /// fast eta to y transformer.
   fast_eta2y eta2y_;
 
+  /// Number of threads used to fill the 3D density.
+  const int nthreads_;
+
   /// cumulant generating approach
   cumulant_generating cgf_;
 
@@ -198,6 +209,11 @@ class Event {
 
   /// WK:
   bool with_ncoll_;
+
+  /// Scratch space for the separable deposition of one nucleon, or one
+  /// binary collision (B): squared x distances of the subgrid columns from
+  /// the nucleon, and the 1D Gaussian kernel along x.
+  std::vector<double> dxsq_, dxsqB_, kernel_x_;
 };
 
 }  // namespace trento
@@ -47,6 +47,21 @@ class NucleonProfile {
   /// WK: return Tpp given bpp^2
   double norm_Tpp(double bpp_sqr) const;
 
+  /// The Gaussian thickness factorizes, T(dx^2 + dy^2) =
+  /// prefactor() * gaussian_factor(dx^2) * gaussian_factor(dy^2)
+  /// within the truncation radius.  Used to deposit a nucleon from 1D x and y
+  /// kernels instead of evaluating the exponential for every cell.
+  double gaussian_factor(double distance_sqr) const;
+
+  /// Thickness prefactor of the current (fluctuated) nucleon.
+  double prefactor() const;
+
+  /// WK: same as above, but without the Gamma fluctuation.
+  double deterministic_prefactor() const;
+
+  /// The squared radius at which the nucleon profile is truncated.
+  double radius_sqr() const;
+
   /// Randomly determine if a pair of nucleons participates.
   bool participate(Nucleon& A, Nucleon& B) const;
 
@@ -194,8 +209,28 @@ inline double NucleonProfile::deterministic_thickness(double distance_sqr) const
 
 // WK
 inline double NucleonProfile::norm_Tpp(double bpp_sqr) const  {
+  // for bpp beyond sqrt(2) truncation radii the argument is outside the
+  // range fast_exp_ is tabulated for
   return one_div_four_pi_ / width_sqr_ 
-		* fast_exp_(neg_one_div_four_width_sqr_*bpp_sqr);
+		* std::exp(neg_one_div_four_width_sqr_*bpp_sqr);
+}
+
+inline double NucleonProfile::gaussian_factor(double distance_sqr) const {
+  if (distance_sqr > trunc_radius_sqr_)
+    return 0.;
+  return std::exp(neg_one_div_two_width_sqr_*distance_sqr);
+}
+
+inline double NucleonProfile::prefactor() const {
+  return prefactor_;
+}
+
+inline double NucleonProfile::deterministic_prefactor() const {
+  return math::double_constants::one_div_two_pi / width_sqr_;
+}
+
+inline double NucleonProfile::radius_sqr() const {
+  return trunc_radius_sqr_;
 }
 
 inline bool NucleonProfile::participate(Nucleon& A, Nucleon& B) const {
@@ -164,20 +164,35 @@ void Deuteron::sample_nucleons_impl() {
 
 MinDistNucleus::MinDistNucleus(std::size_t A, double dmin)
     : Nucleus(A),
-      dminsq_(dmin*dmin)
+      dminsq_(dmin*dmin),
+      placed_(dmin > 0. ? dmin : 1., 3)
 {}
 
 bool MinDistNucleus::is_too_close(const_iterator nucleon) const {
   if (dminsq_ < 1e-10)
     return false;
-  for (const_iterator nucleon2 = begin(); nucleon2 != nucleon; ++nucleon2) {
-    auto dx = nucleon->x() - nucleon2->x();
-    auto dy = nucleon->y() - nucleon2->y();
-    auto dz = nucleon->z() - nucleon2->z();
-    if (dx*dx + dy*dy + dz*dz < dminsq_)
-      return true;
-  }
-  return false;
+  // Only nucleons in the neighboring cells can be within dmin.
+  bool too_close = false;
+  placed_.for_each_candidate(nucleon->x(), nucleon->y(), nucleon->z(),
+    [this, nucleon, &too_close](std::size_t i) {
+      const auto& nucleon2 = *(begin() + i);
+      auto dx = nucleon->x() - nucleon2.x();
+      auto dy = nucleon->y() - nucleon2.y();
+      auto dz = nucleon->z() - nucleon2.z();
+      if (dx*dx + dy*dy + dz*dz < dminsq_)
+        too_close = true;
+    });
+  return too_close;
+}
+
+void MinDistNucleus::clear_placed() {
+  placed_.clear();
+}
+
+void MinDistNucleus::place(const_iterator nucleon) {
+  if (dminsq_ < 1e-10)
+    return;
+  placed_.insert(nucleon - begin(), nucleon->x(), nucleon->y(), nucleon->z());
 }
 
 // Extend the W-S dist out to R + 10a; for typical values of (R, a), the
@@ -215,6 +230,7 @@ void WoodsSaxonNucleus::sample_nucleons_impl() {
   std::sort(radii.begin(), radii.end());
 
   // Place each nucleon at a pre-sampled radius.
+  clear_placed();
   auto r_iter = radii.cbegin();
   for (iterator nucleon = begin(); nucleon != end(); ++nucleon) {
     // Get radius and advance iterator.
@@ -244,6 +260,7 @@ void WoodsSaxonNucleus::sample_nucleons_impl() {
       //          1.5 fm, ~0.1%
       //          1.73 fm, ~1%
     } while (++ntries < 1000 && is_too_close(nucleon));
+    place(nucleon);
   }
   // XXX: re-center nucleon positions?
 }
@@ -338,6 +355,7 @@ void DeformedWoodsSaxonNucleus::sample_nucleons_impl() {
   );
 
   // Place each nucleon at a pre-sampled (r, cos_theta).
+  clear_placed();
   auto sample = samples.cbegin();
   for (iterator nucleon = begin(); nucleon != end(); ++nucleon, ++sample) {
     auto& r = sample->r;
@@ -379,6 +397,7 @@ void DeformedWoodsSaxonNucleus::sample_nucleons_impl() {
       //          1.3 fm, ~0.3%
       //          1.5 fm, ~1.2%
     } while (++ntries < 1000 && is_too_close(nucleon));
+    place(nucleon);
   }
 }
 
@@ -11,6 +11,7 @@
 #include <string>
 #include <vector>
 
+#include "cell_list.h"
 #include "fwd_decl.h"
 #include "nucleon.h"
 
@@ -185,14 +186,23 @@ class MinDistNucleus : public Nucleus {
 
   /// \rst
   /// Check if a ``Nucleon`` is too close (within the minimum distance) of any
-  /// previously placed nucleons.  Specifically, check nucleons from ``begin()``
-  /// up to the given iterator.
+  /// previously placed nucleons, i.e. those passed to ``place()`` since the
+  /// last ``clear_placed()``.
   /// \endrst
   bool is_too_close(const_iterator nucleon) const;
 
+  /// Forget all placed nucleons, call before placing a new nucleus.
+  void clear_placed();
+
+  /// Mark a nucleon as placed at its current position.
+  void place(const_iterator nucleon);
+
  private:
   /// Internal storage of squared minimum distance.
   const double dminsq_;
+
+  /// Placed nucleons, sorted into cells of the minimum distance.
+  CellList placed_;
 };
 
 /// \rst
@@ -73,14 +73,14 @@ public:
     }
   }
 
-  double rapidity(double eta){
+  double rapidity(double eta) const {
     double steps = (eta + etamax_)/deta_;
     double xi = std::fmod(steps, 1.);
     std::size_t index = std::floor(steps);
     return y_[index]*(1. - xi) + y_[index+1]*xi;
   }
 
-  double Jacobian(double eta){
+  double Jacobian(double eta) const {
     double steps = (eta + etamax_)/deta_;
     double xi = std::fmod(steps, 1.);
     std::size_t index = std::floor(steps);
@@ -102,14 +102,15 @@ public:
 /// e.g.), with 256 points. The transformed results are stored and interpolated. 
 class cumulant_generating{
 private:
-  size_t const N;
-  double * data, * dsdy;
+  size_t N;
+  std::vector<double> data, dsdy;
   double eta_max;
   double deta;
   double center;
 
 public:
-  cumulant_generating(): N(256), data(new double[2*N]), dsdy(new double[2*N]){};
+  /// The buffers are owned, so that every thread can use its own copy
+  cumulant_generating(): N(256), data(2*N), dsdy(2*N){};
 
   /// This function set the mean, std and skew of the profile and use FFT to
   /// transform cumulant generating function at zero mean.
@@ -131,7 +132,7 @@ public:
       REAL(data,i) = amp*std::cos(arg);
           IMAG(data,i) = amp*std::sin(arg);
       }
-       gsl_fft_complex_radix2_forward(data, 1, N);
+       gsl_fft_complex_radix2_forward(data.data(), 1, N);
 
       for(size_t i=0;i<N;i++){
           dsdy[i] = REAL(data,i)*(2.0*static_cast<double>(i%2 == 0)-1.0);
@@ -141,7 +142,7 @@ public:
   /// When interpolating the funtion, the mean is put back by simply shifting 
   /// the function by y = y - mean + dy/2, the last term is correcting for
   /// interpolating bin edge instead of bin center
-  double interp_dsdy(double y){
+  double interp_dsdy(double y) const {
     y = y-center+deta/2.;
     if (y < -eta_max || y >= eta_max) return 0.0;
     double xy = (y+eta_max)/deta;
@@ -202,7 +202,10 @@ int main(int argc, char* argv[]) {
      "pseudorapidity max \n(eta grid from -max to +max)")
     ("eta-step",
      po::value<double>()->value_name("FLOAT")->default_value(0.5, "0.5"),
-     "pseudorapidity step size");
+     "pseudorapidity step size")
+    ("threads",
+     po::value<int>()->value_name("INT")->default_value(1, "1"),
+     "threads filling the 3D density\n(0 = all hardware threads)");
 
   // Make a meta-group containing all the option groups except the main
   // positional options (don't want the auto-generated usage info for those).
@@ -7,9 +7,14 @@
 #include "catch.hpp"
 #include "util.h"
 
+#include <algorithm>
 #include <iostream>
+#include <set>
 
+#include "../src/cell_list.h"
+#include "../src/nucleon.h"
 #include "../src/nucleus.h"
+#include "../src/random.h"
 
 using namespace trento;
 
@@ -25,8 +30,8 @@ TEST_CASE( "collider" ) {
     {"b-max", -1.},
     {"normalization", 1.},
     {"reduced-thickness", 0.},
-    {"grid-max", 9.},
-    {"grid-step", 0.3},
+    {"xy-max", 9.},
+    {"xy-step", 0.3},
     {"fluctuation", 1.},
     {"cross-section", 6.4},
     {"nucleon-width", 0.5},
@@ -62,7 +67,7 @@ TEST_CASE( "collider" ) {
   CHECK( nevent == sequence );
 
   // verify impact parameters are within min-bias range
-  auto impact_max = 2*Nucleus::create("Pb")->radius() + 6*.5;
+  auto impact_max = 2*Nucleus::create("Pb", .5)->radius() + 6*.5;
   CHECK( impact >= std::vector<double>(N, 0.) );
   CHECK( impact <= std::vector<double>(N, impact_max) );
 
@@ -87,8 +92,8 @@ TEST_CASE( "fixed impact parameter" ) {
     {"b-max", bfixed},
     {"normalization", 1.},
     {"reduced-thickness", 0.},
-    {"grid-max", 9.},
-    {"grid-step", 0.3},
+    {"xy-max", 9.},
+    {"xy-step", 0.3},
     {"fluctuation", 1.},
     {"cross-section", 6.4},
     {"nucleon-width", 0.5},
@@ -133,8 +138,8 @@ TEST_CASE( "random seed" ) {
         {"b-max", -1.},
         {"normalization", 1.},
         {"reduced-thickness", 0.},
-        {"grid-max", 9.},
-        {"grid-step", 0.3},
+        {"xy-max", 9.},
+        {"xy-step", 0.3},
         {"fluctuation", 1.},
         {"cross-section", 6.4},
         {"nucleon-width", 0.5},
@@ -151,3 +156,124 @@ TEST_CASE( "random seed" ) {
   CHECK( std::all_of(output.cbegin(), output.cend(),
     [&output](const std::string& s) { return s == output.front(); }) );
 }
+
+TEST_CASE( "cell list" ) {
+  // The candidates of a position must include every point within range,
+  // also for negative coordinates and for cells folded onto the same bucket.
+  for (auto dims : {2, 3}) {
+    auto range = 1. + 2.*random::canonical<>();
+    CellList cells{range, dims};
+
+    std::vector<double> x, y, z;
+    for (std::size_t i = 0; i < 500; ++i) {
+      x.push_back(60.*random::canonical<>() - 30.);
+      y.push_back(60.*random::canonical<>() - 30.);
+      z.push_back(dims == 3 ? 60.*random::canonical<>() - 30. : 0.);
+      cells.insert(i, x[i], y[i], z[i]);
+    }
+
+    auto all_found = true;
+    for (auto n = 0; n < 200; ++n) {
+      auto qx = 60.*random::canonical<>() - 30.;
+      auto qy = 60.*random::canonical<>() - 30.;
+      auto qz = dims == 3 ? 60.*random::canonical<>() - 30. : 0.;
+
+      std::set<std::size_t> candidates;
+      cells.for_each_candidate(qx, qy, qz,
+        [&candidates](std::size_t i) { candidates.insert(i); });
+
+      for (std::size_t i = 0; i < x.size(); ++i) {
+        auto dx = x[i] - qx, dy = y[i] - qy, dz = z[i] - qz;
+        if (dx*dx + dy*dy + dz*dz <= range*range && !candidates.count(i))
+          all_found = false;
+      }
+    }
+    CHECK( all_found );
+
+    // a cleared list has no candidates
+    cells.clear();
+    auto count = 0;
+    cells.for_each_candidate(x[0], y[0], z[0], [&count](std::size_t) { ++count; });
+    CHECK( count == 0 );
+  }
+}
+
+TEST_CASE( "cell list pair search" ) {
+  // Visiting only the cell list candidates of each nucleon of A, in the
+  // order of B, gives the same participants and consumes the same random
+  // numbers as the loop over all nucleon pairs.
+  auto var_map = make_var_map({
+    {"fluctuation", 1.},
+    {"cross-section", 6.4},
+    {"nucleon-width", 0.5},
+  });
+  NucleonProfile profile{var_map};
+
+  auto nucleusA = Nucleus::create("Pb", .5);
+  auto nucleusB = Nucleus::create("Pb", .5);
+  CellList cellsB{profile.max_impact(), 2};
+  std::vector<std::size_t> candidates;
+
+  auto participants = [](const Nucleus& nucleus) {
+    std::vector<bool> flags;
+    for (const auto& nucleon : nucleus)
+      flags.push_back(nucleon.is_participant());
+    return flags;
+  };
+
+  for (auto n = 0; n < 5; ++n) {
+    auto b = 12.*random::canonical<>();
+    auto state = random::engine;
+
+    // all pairs
+    nucleusA->sample_nucleons(.5*b);
+    nucleusB->sample_nucleons(-.5*b);
+    for (auto&& A : *nucleusA)
+      for (auto&& B : *nucleusB)
+        profile.participate(A, B);
+    auto all_pairsA = participants(*nucleusA);
+    auto all_pairsB = participants(*nucleusB);
+    auto all_pairs_state = random::engine;
+
+    // cell list candidates, as in Collider::sample_impact_param
+    random::engine = state;
+    nucleusA->sample_nucleons(.5*b);
+    nucleusB->sample_nucleons(-.5*b);
+    cellsB.clear();
+    auto beginB = nucleusB->begin();
+    for (auto B = beginB; B != nucleusB->end(); ++B)
+      cellsB.insert(B - beginB, B->x(), B->y());
+    for (auto&& A : *nucleusA) {
+      candidates.clear();
+      cellsB.for_each_candidate(A.x(), A.y(), 0.,
+        [&candidates](std::size_t i) { candidates.push_back(i); });
+      std::sort(candidates.begin(), candidates.end());
+      for (auto i : candidates)
+        profile.participate(A, *(beginB + i));
+    }
+
+    CHECK( participants(*nucleusA) == all_pairsA );
+    CHECK( participants(*nucleusB) == all_pairsB );
+    CHECK( random::engine == all_pairs_state );
+  }
+}
+
+TEST_CASE( "minimum nucleon distance" ) {
+  // The cell list of placed nucleons must still keep every pair apart.
+  auto dmin = 1.;
+  auto nucleus = Nucleus::create("Au", .5, dmin);
+
+  for (auto n = 0; n < 3; ++n) {
+    nucleus->sample_nucleons(0.);
+    auto too_close = 0;
+    for (auto i = nucleus->cbegin(); i != nucleus->cend(); ++i) {
+      for (auto j = std::next(i); j != nucleus->cend(); ++j) {
+        auto dx = i->x() - j->x(), dy = i->y() - j->y(), dz = i->z() - j->z();
+        if (dx*dx + dy*dy + dz*dz < dmin*dmin)
+          ++too_close;
+      }
+    }
+    // the sampler gives up on a nucleon that cannot be placed, which is rare
+    CHECK( too_close <= 2 );
+  }
+}
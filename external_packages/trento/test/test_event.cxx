@@ -4,9 +4,13 @@
 
 #include "../src/event.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "catch.hpp"
 #include "util.h"
 
+#include "../src/nucleon.h"
 #include "../src/nucleus.h"
 #include "../src/random.h"
 
@@ -35,8 +39,8 @@ TEST_CASE( "event" ) {
     auto var_map = make_var_map({
         {"normalization", norm},
         {"reduced-thickness", p},
-        {"grid-max", grid_max},
-        {"grid-step", grid_step},
+        {"xy-max", grid_max},
+        {"xy-step", grid_step},
         {"fluctuation",   fluct},
         {"cross-section", xsec},
         {"nucleon-width", nucleon_width},
@@ -45,12 +49,14 @@ TEST_CASE( "event" ) {
     Event event{var_map};
     NucleonProfile profile{var_map};
 
-    CHECK( event.reduced_thickness_grid().num_dimensions() == 2 );
-    CHECK( static_cast<int>(event.reduced_thickness_grid().shape()[0]) == grid_nsteps );
-    CHECK( static_cast<int>(event.reduced_thickness_grid().shape()[1]) == grid_nsteps );
+    // 2D events keep TR as a grid with a single rapidity bin
+    CHECK( event.density_grid().num_dimensions() == 3 );
+    CHECK( static_cast<int>(event.density_grid().shape()[0]) == grid_nsteps );
+    CHECK( static_cast<int>(event.density_grid().shape()[1]) == grid_nsteps );
+    CHECK( static_cast<int>(event.density_grid().shape()[2]) == 1 );
 
-    auto nucleusA = Nucleus::create("Pb");
-    auto nucleusB = Nucleus::create("Pb");
+    auto nucleusA = Nucleus::create("Pb", nucleon_width);
+    auto nucleusB = Nucleus::create("Pb", nucleon_width);
 
     // Sample impact param, nucleons, and participants.
     auto b = 4.*std::sqrt(random::canonical<>());
@@ -78,13 +84,15 @@ TEST_CASE( "event" ) {
     // Compute TR grid the slow way -- switch the order of grid and nucleon loops.
     boost::multi_array<double, 2> TR{boost::extents[grid_nsteps][grid_nsteps]};
 
-    auto thickness = [&profile](const Nucleus& nucleus, double x, double y) {
+    auto thickness = [&profile, nucleon_width](const Nucleus& nucleus, double x, double y) {
       auto t = 0.;
       for (const auto& n : nucleus) {
         if (n.is_participant()) {
           auto dx = n.x() - x;
           auto dy = n.y() - y;
-          t += profile.thickness(dx*dx + dy*dy);
+          auto dsq = dx*dx + dy*dy;
+          if (dsq < profile.radius_sqr())
+            t += profile.prefactor() * std::exp(-.5*dsq/(nucleon_width*nucleon_width));
         }
       }
       return t;
@@ -117,7 +125,7 @@ TEST_CASE( "event" ) {
     // Verify each grid element.
     auto all_correct = true;
     for (const auto* t1 = TR.origin(),
-         * t2 = event.reduced_thickness_grid().origin();
+         * t2 = event.density_grid().origin();
          t1 != TR.origin() + TR.num_elements();
          ++t1, ++t2) {
       if (*t1 != Approx(*t2).epsilon(1e-5)) {
@@ -164,13 +172,98 @@ TEST_CASE( "event" ) {
   auto var_map = make_var_map({
       {"normalization", 1.},
       {"reduced-thickness", 0.},
-      {"grid-max", 10.},
-      {"grid-step", 0.3}
+      {"xy-max", 10.},
+      {"xy-step", 0.3}
   });
 
   Event event{var_map};
 
-  CHECK( event.reduced_thickness_grid().num_dimensions() == 2 );
-  CHECK( event.reduced_thickness_grid().shape()[0] == 67 );
-  CHECK( event.reduced_thickness_grid().shape()[1] == 67 );
+  CHECK( event.density_grid().shape()[0] == 67 );
+  CHECK( event.density_grid().shape()[1] == 67 );
+}
+
+TEST_CASE( "separable nucleon deposition" ) {
+  // The thickness grid is deposited from 1D x and y kernels; check that the
+  // product of the factors reproduces the full Gaussian within the radius.
+  // Compare to std::exp since thickness() uses the approximate FastExp.
+  auto width = .5 + .2*random::canonical<>();
+  auto var_map = make_var_map({
+      {"fluctuation",   1.},
+      {"cross-section", 6.4},
+      {"nucleon-width", width},
+  });
+
+  NucleonProfile profile{var_map};
+  profile.fluctuate();
+
+  auto R = profile.radius();
+  for (auto i = 0; i < 100; ++i) {
+    auto dx = R*(2*random::canonical<>() - 1);
+    auto dy = R*(2*random::canonical<>() - 1);
+    auto dsq = dx*dx + dy*dy;
+    if (dsq > profile.radius_sqr())
+      continue;
+    auto separable = profile.prefactor() *
+      profile.gaussian_factor(dx*dx) * profile.gaussian_factor(dy*dy);
+    auto exact = profile.prefactor() * std::exp(-.5*dsq/(width*width));
+    CHECK( separable == Approx(exact).epsilon(1e-12) );
+  }
+
+  // each factor vanishes beyond the truncation radius
+  auto outside = R*(1 + random::canonical<>());
+  CHECK( profile.gaussian_factor(outside*outside) == 0. );
+}
+
+TEST_CASE( "3D density thread independence" ) {
+  // Each thread fills its own block of rows with its own cumulant generating
+  // function, so the 3D density must not depend on the thread count.
+  auto make_event_map = [](int threads) {
+    return make_var_map({
+        {"normalization", 1.},
+        {"reduced-thickness", 0.},
+        {"xy-max", 9.},
+        {"xy-step", 0.3},
+        {"eta-max", 4.},
+        {"eta-step", 0.5},
+        {"beam-energy", 200.},
+        {"mean-coeff", 1.},
+        {"std-coeff", 3.},
+        {"skew-coeff", 0.},
+        {"fluctuation", 1.},
+        {"cross-section", 4.2},
+        {"nucleon-width", .5},
+        {"threads", threads},
+    });
+  };
+
+  auto serial_map = make_event_map(1);
+  auto nucleusA = Nucleus::create("Au", .5);
+  auto nucleusB = Nucleus::create("Au", .5);
+  NucleonProfile profile{serial_map};
+
+  auto b = 2.;
+  nucleusA->sample_nucleons(+.5*b);
+  nucleusB->sample_nucleons(-.5*b);
+  for (auto&& A : *nucleusA)
+    for (auto&& B : *nucleusB)
+      profile.participate(A, B);
+
+  // replay the same nucleon fluctuations for both events; the profile is
+  // copied too since its gamma distribution caches normal variates
+  auto state = random::engine;
+  auto parallel_profile = profile;
+  Event serial{serial_map};
+  serial.compute(*nucleusA, *nucleusB, profile);
+
+  random::engine = state;
+  Event parallel{make_event_map(4)};
+  parallel.compute(*nucleusA, *nucleusB, parallel_profile);
+
+  const auto& grid1 = serial.density_grid();
+  const auto& grid4 = parallel.density_grid();
+  REQUIRE( grid1.shape()[2] > 1 );
+  REQUIRE( grid1.num_elements() == grid4.num_elements() );
+  CHECK( std::equal(grid1.origin(), grid1.origin() + grid1.num_elements(),
+                    grid4.origin()) );
+  CHECK( serial.multiplicity() == parallel.multiplicity() );
 }
@@ -19,7 +19,7 @@
 using namespace trento;
 
 TEST_CASE( "proton" ) {
-  auto nucleus = Nucleus::create("p");
+  auto nucleus = Nucleus::create("p", .5);
 
   CHECK( dynamic_cast<Proton*>(nucleus.get()) != nullptr );
 
@@ -45,7 +45,7 @@ TEST_CASE( "proton" ) {
 }
 
 TEST_CASE( "deuteron" ) {
-  auto nucleus = Nucleus::create("d");
+  auto nucleus = Nucleus::create("d", .5);
 
   CHECK( dynamic_cast<Deuteron*>(nucleus.get()) != nullptr );
 
@@ -62,7 +62,7 @@ TEST_CASE( "deuteron" ) {
 }
 
 TEST_CASE( "lead nucleus" ) {
-  auto nucleus = Nucleus::create("Pb");
+  auto nucleus = Nucleus::create("Pb", .5);
 
   CHECK( dynamic_cast<WoodsSaxonNucleus*>(nucleus.get()) != nullptr );
 
@@ -100,8 +100,8 @@ TEST_CASE( "lead nucleus" ) {
 }
 
 TEST_CASE( "copper nucleus" ) {
-  auto nucleus = Nucleus::create("Cu");
-  auto def_nucleus = Nucleus::create("Cu2");
+  auto nucleus = Nucleus::create("Cu", .5);
+  auto def_nucleus = Nucleus::create("Cu2", .5);
 
   CHECK( dynamic_cast<WoodsSaxonNucleus*>(nucleus.get()) != nullptr );
   CHECK( dynamic_cast<DeformedWoodsSaxonNucleus*>(def_nucleus.get()) != nullptr );
@@ -115,8 +115,8 @@ TEST_CASE( "copper nucleus" ) {
 }
 
 TEST_CASE( "gold nucleus" ) {
-  auto nucleus = Nucleus::create("Au");
-  auto def_nucleus = Nucleus::create("Au2");
+  auto nucleus = Nucleus::create("Au", .5);
+  auto def_nucleus = Nucleus::create("Au2", .5);
 
   CHECK( dynamic_cast<WoodsSaxonNucleus*>(nucleus.get()) != nullptr );
   CHECK( dynamic_cast<DeformedWoodsSaxonNucleus*>(def_nucleus.get()) != nullptr );
@@ -130,7 +130,7 @@ TEST_CASE( "gold nucleus" ) {
 }
 
 TEST_CASE( "uranium nucleus" ) {
-  auto nucleus = Nucleus::create("U");
+  auto nucleus = Nucleus::create("U", .5);
 
   CHECK( dynamic_cast<DeformedWoodsSaxonNucleus*>(nucleus.get()) != nullptr );
 
@@ -167,7 +167,7 @@ TEST_CASE( "manual nucleus" ) {
     dataset.write(positions.data(), datatype);
   }
 
-  auto nucleus = Nucleus::create(temp.path.string());
+  auto nucleus = Nucleus::create(temp.path.string(), .5);
 
   CHECK( dynamic_cast<ManualNucleus*>(nucleus.get()) != nullptr );
 
@@ -198,7 +198,7 @@ TEST_CASE( "manual nucleus" ) {
   CHECK( nucleon->y() == Approx(-std::next(nucleon)->y()) );
   CHECK( nucleon->z() == Approx(-std::next(nucleon)->z()) );
 
-  CHECK_THROWS_AS( Nucleus::create("nonexistent.hdf"), std::invalid_argument );
+  CHECK_THROWS_AS( Nucleus::create("nonexistent.hdf", .5), std::invalid_argument );
 }
 
 #endif  // TRENTO_HDF5
@@ -329,7 +329,7 @@ TEST_CASE( "minimum distance" ) {
   for (const auto& species : {"Pb", "U"}) {
     for (auto repeat = 0; repeat < 10; ++repeat) {
       const auto target_dmin = .2 + .4*random::canonical<>();
-      auto nucleus = Nucleus::create("Pb", target_dmin);
+      auto nucleus = Nucleus::create("Pb", .5, target_dmin);
       nucleus->sample_nucleons(10*random::canonical<>());
       auto dminsq = 100.;
       for (auto n1 = nucleus->cbegin(); n1 != nucleus->cend(); ++n1) {
@@ -348,5 +348,5 @@ TEST_CASE( "minimum distance" ) {
 }
 
 TEST_CASE( "unknown nucleus species" ) {
-  CHECK_THROWS_AS( Nucleus::create("hello"), std::invalid_argument );
+  CHECK_THROWS_AS( Nucleus::create("hello", .5), std::invalid_argument );
 }
@@ -20,8 +20,8 @@ TEST_CASE( "output" ) {
   auto var_map = make_var_map({
     {"normalization", 1.},
     {"reduced-thickness", 0.},
-    {"grid-max", 9.},
-    {"grid-step", 0.3},
+    {"xy-max", 9.},
+    {"xy-step", 0.3},
     {"fluctuation", 1.},
     {"cross-section", 6.4},
     {"nucleon-width", 0.5}
@@ -31,8 +31,8 @@ TEST_CASE( "output" ) {
   Event event{var_map};
   NucleonProfile profile{var_map};
 
-  auto nucleusA = Nucleus::create("Pb");
-  auto nucleusB = Nucleus::create("Pb");
+  auto nucleusA = Nucleus::create("Pb", .5);
+  auto nucleusB = Nucleus::create("Pb", .5);
 
   auto b = 4.*std::sqrt(random::canonical<>());
   nucleusA->sample_nucleons(+.5*b);
@@ -155,8 +155,14 @@ TEST_CASE( "output" ) {
         CHECK( std::stod(line.substr(10)) == Approx(ecc.second) );
       }
 
+      for (const auto& psi : event.participant_plane()) {
+        std::getline(ifs, line);
+        CHECK( line.substr(0, 12) == ("# psi" + std::to_string(psi.first) + "    = ") );
+        CHECK( std::stod(line.substr(12)) == Approx(psi.second) );
+      }
+
       // read the grid back in and check each element
-      const auto* iter = event.reduced_thickness_grid().origin();
+      const auto* iter = event.density_grid().origin();
       double check;
       bool all_correct = false;
       while (ifs >> check)
@@ -164,8 +170,8 @@ TEST_CASE( "output" ) {
       CHECK( all_correct );
 
       // verify that all grid elements were checked
-      const auto* grid_end = event.reduced_thickness_grid().origin() +
-                             event.reduced_thickness_grid().num_elements();
+      const auto* grid_end = event.density_grid().origin() +
+                             event.density_grid().num_elements();
       CHECK( iter == grid_end );
     }
 
@@ -208,14 +214,14 @@ TEST_CASE( "output" ) {
       auto dataset = file.openDataSet(name);
 
       // read back in the event grid to another array
-      Event::Grid grid_check{event.reduced_thickness_grid()};
+      Event::Grid grid_check{event.density_grid()};
       dataset.read(grid_check.data(), H5::PredType::NATIVE_DOUBLE);
 
       // verify each grid element
       auto grid_correct = std::equal(
         grid_check.origin(),
         grid_check.origin() + grid_check.num_elements(),
-        event.reduced_thickness_grid().origin(),
+        event.density_grid().origin(),
         [](const double& value_check, const double& value) {
           return value_check == Approx(value);
         }
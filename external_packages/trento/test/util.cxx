@@ -4,9 +4,43 @@
 
 #include "util.h"
 
+#include <cstdint>
+#include <limits>
+
 VarMap make_var_map(std::map<std::string, boost::any>&& args) {
-  VarMap var_map{};
+  // defaults of the trento executable for everything not given
+  std::map<std::string, boost::any> defaults{
+    {"reduced-thickness", 0.},
+    {"fluctuation", 1.},
+    {"nucleon-width", .5},
+    {"nucleon-min-dist", 0.},
+    {"mean-coeff", 1.},
+    {"std-coeff", 3.},
+    {"skew-coeff", 0.},
+    {"skew-type", 1},
+    {"jacobian", 0.8},
+    {"normalization", 1.},
+    {"beam-energy", 2760.},
+    {"cross-section", -1.},
+    {"b-min", 0.},
+    {"b-max", -1.},
+    {"npart-min", 0},
+    {"npart-max", std::numeric_limits<int>::max()},
+    {"s-min", 0.},
+    {"s-max", std::numeric_limits<double>::max()},
+    {"random-seed", static_cast<int64_t>(-1)},
+    {"ncoll", false},
+    {"xy-max", 10.},
+    {"xy-step", .2},
+    {"eta-max", 0.},
+    {"eta-step", .5},
+    {"threads", 1},
+  };
   for (auto&& a : args)
+    defaults[a.first] = a.second;
+
+  VarMap var_map{};
+  for (auto&& a : defaults)
     var_map.emplace(a.first, po::variable_value{a.second, false});
   return var_map;
 }
@@ -104,7 +104,7 @@ void SmashWrapper::ExecuteTask() {
 void SmashWrapper::WriteTask(weak_ptr<JetScapeWriter> w) {
   JSINFO << "SMASH hadronic afterburner printout";
   auto f = w.lock();
-  if (!f) {
+  if (!f || !f->GetVariant().empty()) {
     return;
   }
   AfterburnerModus *modus = smash_experiment_->modus();
@@ -145,7 +145,7 @@ void SmashWrapper::smash_particles_to_JS_hadrons(
     const FourVector hadron_p(p.x1(), p.x2(), p.x3(), p.x0()),
         hadron_r(r.x1(), r.x2(), r.x3(), r.x0());
     const double hadron_mass = p.abs();
-    JS_hadrons.push_back(make_shared<Hadron>(hadron_label, hadron_id,
+    JS_hadrons.push_back(MakeEventShared<Hadron>(hadron_label, hadron_id,
                                              hadron_status, hadron_p, hadron_r,
                                              hadron_mass));
   }
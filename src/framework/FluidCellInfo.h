@@ -18,6 +18,7 @@
 #define FLUIDCELLINFO_H
 
 #include "RealType.h"
+#include <memory>
 
 namespace Jetscape {
 
@@ -111,6 +112,16 @@ inline FluidCellInfo operator/(FluidCellInfo a, Jetscape::real b) {
   return a;
 }
 
+/// Provide an empty cell for a hydro lookup. A cell the caller already
+/// owns is reset and reused rather than allocating a new one per lookup.
+inline void
+ResetFluidCellInfo(std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
+  if (fluid_cell_info_ptr)
+    *fluid_cell_info_ptr = FluidCellInfo();
+  else
+    fluid_cell_info_ptr.reset(new FluidCellInfo());
+}
+
 // print the fluid cell information for debuging
 // this function has bugs
 //std::ostream &operator<<(std::ostream &os, const FluidCellInfo &cell) {
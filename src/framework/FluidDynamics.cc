@@ -21,6 +21,9 @@
 #include "JetScapeSignalManager.h"
 #include "MakeUniqueHelper.h"
 #include "SurfaceFinder.h"
+#include "JetScapeXML.h"
+#include "JetScapeMemoryPlacement.h"
+#include "tinyxml2.h"
 
 #define MAGENTA "\033[35m"
 
@@ -32,6 +35,7 @@ FluidDynamics::FluidDynamics() {
   VERBOSE(8);
   eta = -99.99;
   boost_invariant_ = true;
+  sparse_storage_ = false;
   SetId("FluidDynamics");
 }
 
@@ -60,6 +64,33 @@ void FluidDynamics::Init() {
   }
 
   InitializeHydro(parameter_list);
+
+  if (GetXMLElementInt({"Hydro", "cache", "enabled"}) == 1) {
+    if (IsHydroEvolutionCacheable()) {
+      hydro_cache_ = std::unique_ptr<HydroCache>(new HydroCache(
+          GetXMLElementText({"Hydro", "cache", "directory"}),
+          GetXMLElementDouble({"Hydro", "cache", "max_size_in_GB"})));
+      JSINFO << "Hydro cache for " << GetId() << " in "
+             << hydro_cache_->GetDirectory();
+    } else {
+      JSINFO << "The evolution of " << GetId() << " is not cacheable";
+    }
+  }
+
+  sparse_storage_ =
+      GetXMLElementInt({"Hydro", "sparse_storage", "enabled"}) == 1;
+  if (sparse_storage_) {
+    sparse_T_min_ = GetXMLElementDouble({"Hydro", "sparse_storage", "T_min"});
+    sparse_tolerance_ =
+        GetXMLElementDouble({"Hydro", "sparse_storage", "tolerance"});
+    sparse_block_size_ =
+        GetXMLElementInt({"Hydro", "sparse_storage", "block_size"});
+    sparse_max_tau_stride_ =
+        GetXMLElementInt({"Hydro", "sparse_storage", "max_tau_stride"});
+    JSINFO << "Sparse evolution storage for " << GetId()
+           << ": T_min = " << sparse_T_min_
+           << " GeV, tolerance = " << sparse_tolerance_;
+  }
   InitTask();
 
   JetScapeTask::InitTasks();
@@ -74,10 +105,86 @@ void FluidDynamics::Exec() {
                << ini->GetEntropyDensityDistribution().size();
   }
 
-  EvolveHydro();
+  // the cache stores dense histories, otherwise sparsify while filling
+  bool cached = hydro_cache_ && IsHydroEvolutionCacheable();
+  if (sparse_storage_ && !cached) {
+    bulk_info.StartSparseFilling(sparse_T_min_, sparse_tolerance_,
+                                 sparse_block_size_, sparse_max_tau_stride_);
+  }
+
+  if (cached) {
+    std::string key = GetHydroCacheKey();
+    if (hydro_cache_->Load(key, bulk_info, surfaceCellVector_)) {
+      JSINFO << "Hydro cache hit " << key << ", skipping the evolution of "
+             << GetId();
+      if (pre_eq_ptr) {
+        pre_eq_ptr->clear_evolution_data();
+      }
+      hydro_status = FINISHED;
+    } else {
+      EvolveHydro();
+      if (hydro_status == FINISHED) {
+        hydro_cache_->Store(key, bulk_info, surfaceCellVector_);
+      }
+    }
+  } else {
+    EvolveHydro();
+  }
+
+  if (sparse_storage_ && hydro_status == FINISHED) {
+    if (bulk_info.is_sparse_filling()) {
+      bulk_info.FinishSparseFilling();
+    } else {
+      bulk_info.Sparsify(sparse_T_min_, sparse_tolerance_, sparse_block_size_,
+                         sparse_max_tau_stride_);
+    }
+  }
+  // Read-mostly from here on, by the eloss threads on all sockets
+  if (hydro_status == FINISHED) {
+    bulk_info.PlaceInMemory();
+  }
   JetScapeTask::ExecuteTasks();
 }
 
+std::string FluidDynamics::GetHydroCacheKey() {
+  HydroCacheDigest digest;
+  digest.Add(std::string("JETSCAPE hydro cache"));
+  digest.Add(GetId());
+  if (pre_eq_ptr) {
+    digest.Add(pre_eq_ptr->GetId());
+  }
+
+  // settings of this and the upstream stage, except for the cache itself
+  auto xml = JetScapeXML::Instance();
+  std::vector<tinyxml2::XMLElement *> roots;
+  if (xml->IsMainFileOpen())
+    roots.push_back(xml->GetXMLRootMain());
+  if (xml->IsUserFileOpen())
+    roots.push_back(xml->GetXMLRootUser());
+  for (auto root : roots) {
+    for (const char *section : {"Preequilibrium", "Hydro"}) {
+      auto element = root ? root->FirstChildElement(section) : nullptr;
+      auto child = element ? element->FirstChildElement() : nullptr;
+      for (; child; child = child->NextSiblingElement()) {
+        if (std::string(child->Name()) == "cache")
+          continue;
+        tinyxml2::XMLPrinter printer(nullptr, true);
+        child->Accept(&printer);
+        digest.Add(std::string(printer.CStr()));
+      }
+    }
+  }
+
+  if (ini) {
+    double steps[3] = {ini->GetXStep(), ini->GetYStep(), ini->GetZStep()};
+    int sizes[3] = {ini->GetXSize(), ini->GetYSize(), ini->GetZSize()};
+    digest.Add(steps, sizeof(steps));
+    digest.Add(sizes, sizeof(sizes));
+    digest.Add(ini->GetEntropyDensityDistribution());
+  }
+  return digest.Hex();
+}
+
 void FluidDynamics::Clear() {
   clear_up_evolution_data();
   if (!weak_ptr_is_uninitialized(liquefier_ptr)) {
@@ -85,6 +192,16 @@ void FluidDynamics::Clear() {
   }
 }
 
+void FluidDynamics::GetHydroInfoDifference(
+    Jetscape::real t, Jetscape::real x, Jetscape::real y, Jetscape::real z,
+    FluidDynamics &background,
+    std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
+  std::unique_ptr<FluidCellInfo> background_cell_ptr;
+  background.GetHydroInfo(t, x, y, z, background_cell_ptr);
+  GetHydroInfo(t, x, y, z, fluid_cell_info_ptr);
+  *fluid_cell_info_ptr = *fluid_cell_info_ptr + (-1.0) * (*background_cell_ptr);
+}
+
 void FluidDynamics::CollectHeader(weak_ptr<JetScapeWriter> w) {
   auto f = w.lock();
   if (f) {
@@ -34,6 +34,7 @@
 #include "FluidEvolutionHistory.h"
 #include "LiquefierBase.h"
 #include "SurfaceCellInfo.h"
+#include "HydroCache.h"
 
 namespace Jetscape {
 
@@ -74,6 +75,14 @@ protected:
 
   std::weak_ptr<LiquefierBase> liquefier_ptr;
 
+  /** On-disk cache of finished evolutions, set up from <Hydro><cache>. */
+  std::unique_ptr<HydroCache> hydro_cache_;
+
+  /** Settings of the sparse evolution storage, from <Hydro><sparse_storage>. */
+  bool sparse_storage_;
+  Jetscape::real sparse_T_min_, sparse_tolerance_;
+  int sparse_block_size_, sparse_max_tau_stride_;
+
 public:
   /** Default constructor. task ID as "FluidDynamics",
         eta is initialized to -99.99.
@@ -144,6 +153,16 @@ public:
   /** Default function to evolve the hydrodynamics. It can be overridden by different modules. */
   virtual void EvolveHydro(){};
 
+  /** Whether the evolution of this module may be taken from the hydro cache.
+      It should only return true if EvolveHydro() is a deterministic function
+      of the initial state and the Preequilibrium and Hydro settings, and all
+      lookups are served from bulk_info and the surface cell vector. */
+  virtual bool IsHydroEvolutionCacheable() const { return false; }
+
+  /** @return Freeze-out surface file written by this module for readers
+      such as iSS, or an empty path if the surface is only kept in memory. */
+  virtual std::string GetSurfaceFile() const { return ""; }
+
   /** @return Status of the hydrodynamics (NOT_START, INITIALIZED, EVOLVING, FINISHED, ERROR). */
   int GetHydroStatus() const { return (hydro_status); }
 
@@ -193,7 +212,7 @@ public:
   GetHydroInfo(Jetscape::real t, Jetscape::real x, Jetscape::real y,
                Jetscape::real z,
                std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
-    if (hydro_status != FINISHED || bulk_info.data.size() == 0) {
+    if (hydro_status != FINISHED || bulk_info.get_data_size() == 0) {
       throw std::runtime_error("Hydro evolution is not finished "
                                "or EvolutionHistory is empty");
     }
@@ -209,6 +228,21 @@ public:
     }
   }
 
+  /** Retrieves the difference between this medium and a background medium
+     * at a given space-time point. For a hydro pass run with jet source
+     * terms against the pass without them, this is the medium response.
+     @param time Time or tau coordinate.
+     @param x Space coordinate.
+     @param y Space coordinate.
+     @param z Space or eta coordinate.
+     @param background The medium to subtract.
+     @param fluid_cell_info_ptr A pointer to the FluidCellInfo class.
+    */
+  void GetHydroInfoDifference(
+      Jetscape::real t, Jetscape::real x, Jetscape::real y, Jetscape::real z,
+      FluidDynamics &background,
+      std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr);
+
   // this function print out the information of the fluid cell to the screen
   /** It prints out the information of the fluid cell.
 	@param fluid_cell_info_ptr A pointer to FluidCellInfor class.
@@ -309,6 +343,11 @@ public:
   /// slots for "jet" signals (future)
   virtual void GetEnergyDensity(int t, double &edensity) { edensity = 0.0; }
 
+  /** @return The hydro cache key of the current event: a digest of the
+      initial-state grid, the pre-equilibrium module and the Preequilibrium
+      and Hydro settings. */
+  std::string GetHydroCacheKey();
+
   // get a reference to the bulk_info object
   const EvolutionHistory& get_bulk_info() const { return bulk_info; }
 
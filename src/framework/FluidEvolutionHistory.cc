@@ -15,11 +15,14 @@
 // This is a general basic class for hydrodynamics
 
 #include <string>
+#include <cmath>
+#include <map>
 #include <MakeUniqueHelper.h>
 #include "FluidEvolutionHistory.h"
 #include "FluidCellInfo.h"
 #include "LinearInterpolation.h"
 #include "JetScapeLogger.h"
+#include "JetScapeMemoryPlacement.h"
 
 namespace Jetscape {
 
@@ -106,6 +109,7 @@ void EvolutionHistory::FromVector(const std::vector<float> &data_,
                                   float dx_, int nx_, float y_min_, float dy_,
                                   int ny_, float eta_min_, float deta_,
                                   int neta_, bool tau_eta_is_tz_) {
+  ClearSparseStorage();
   data_vector = data_;
   data_info = data_info_;
   tau_min = tau_min_;
@@ -127,6 +131,10 @@ void EvolutionHistory::FromVector(const std::vector<float> &data_,
  * information data_info_ into to FluidCellInfo object */
 FluidCellInfo EvolutionHistory::GetFluidCell(int id_tau, int id_x, int id_y,
                                              int id_eta) const {
+  if (sparse_) {
+    return GetSparseFluidCell(id_tau, id_x, id_y, id_eta);
+  }
+
   int entries_per_record = data_info.size();
   int id_eta_corrected = id_eta;
   // set id_eta=0 if hydro is in 2+1D mode
@@ -139,10 +147,11 @@ FluidCellInfo EvolutionHistory::GetFluidCell(int id_tau, int id_x, int id_y,
   // if data_vector and data_info are not used to construct evolution history
   // then the data should have the format of vector<FluidCellInfo>.
   if (entries_per_record == 0) {
-    return data.at(record_starting_id);
+    // while the sparse storage is filled, data starts at data_first_tau_
+    return data.at(record_starting_id - data_first_tau_ * GetTauSliceSize());
   }
   // otherwise construct the fluid cell info from data_vector and data_info
-  auto fluid_cell_ptr = make_unique<FluidCellInfo>();
+  FluidCellInfo fluid_cell;
 
   record_starting_id *= entries_per_record;
   for (int i = 0; i < entries_per_record; i++) {
@@ -150,76 +159,76 @@ FluidCellInfo EvolutionHistory::GetFluidCell(int id_tau, int id_x, int id_y,
     auto entry_data = data_vector.at(record_starting_id + i);
     switch (entry_name) {
     case ENTRY_ENERGY_DENSITY:
-      fluid_cell_ptr->energy_density = entry_data;
+      fluid_cell.energy_density = entry_data;
       break;
     case ENTRY_ENTROPY_DENSITY:
-      fluid_cell_ptr->entropy_density = entry_data;
+      fluid_cell.entropy_density = entry_data;
       break;
     case ENTRY_TEMPERATURE:
-      fluid_cell_ptr->temperature = entry_data;
+      fluid_cell.temperature = entry_data;
       break;
     case ENTRY_PRESSURE:
-      fluid_cell_ptr->pressure = entry_data;
+      fluid_cell.pressure = entry_data;
       break;
     case ENTRY_QGP_FRACTION:
-      fluid_cell_ptr->qgp_fraction = entry_data;
+      fluid_cell.qgp_fraction = entry_data;
       break;
     case ENTRY_MU_B:
-      fluid_cell_ptr->mu_B = entry_data;
+      fluid_cell.mu_B = entry_data;
       break;
     case ENTRY_MU_C:
-      fluid_cell_ptr->mu_C = entry_data;
+      fluid_cell.mu_C = entry_data;
       break;
     case ENTRY_MU_S:
-      fluid_cell_ptr->mu_S = entry_data;
+      fluid_cell.mu_S = entry_data;
       break;
     case ENTRY_VX:
-      fluid_cell_ptr->vx = entry_data;
+      fluid_cell.vx = entry_data;
       break;
     case ENTRY_VY:
-      fluid_cell_ptr->vy = entry_data;
+      fluid_cell.vy = entry_data;
       break;
     case ENTRY_VZ:
-      fluid_cell_ptr->vz = entry_data;
+      fluid_cell.vz = entry_data;
       break;
     case ENTRY_PI00:
-      fluid_cell_ptr->pi[0][0] = entry_data;
+      fluid_cell.pi[0][0] = entry_data;
       break;
     case ENTRY_PI01:
-      fluid_cell_ptr->pi[0][1] = entry_data;
-      fluid_cell_ptr->pi[1][0] = entry_data;
+      fluid_cell.pi[0][1] = entry_data;
+      fluid_cell.pi[1][0] = entry_data;
       break;
     case ENTRY_PI02:
-      fluid_cell_ptr->pi[0][2] = entry_data;
-      fluid_cell_ptr->pi[2][0] = entry_data;
+      fluid_cell.pi[0][2] = entry_data;
+      fluid_cell.pi[2][0] = entry_data;
       break;
     case ENTRY_PI03:
-      fluid_cell_ptr->pi[0][3] = entry_data;
-      fluid_cell_ptr->pi[3][0] = entry_data;
+      fluid_cell.pi[0][3] = entry_data;
+      fluid_cell.pi[3][0] = entry_data;
       break;
     case ENTRY_PI11:
-      fluid_cell_ptr->pi[1][1] = entry_data;
+      fluid_cell.pi[1][1] = entry_data;
       break;
     case ENTRY_PI12:
-      fluid_cell_ptr->pi[1][2] = entry_data;
-      fluid_cell_ptr->pi[2][1] = entry_data;
+      fluid_cell.pi[1][2] = entry_data;
+      fluid_cell.pi[2][1] = entry_data;
       break;
     case ENTRY_PI13:
-      fluid_cell_ptr->pi[1][3] = entry_data;
-      fluid_cell_ptr->pi[3][1] = entry_data;
+      fluid_cell.pi[1][3] = entry_data;
+      fluid_cell.pi[3][1] = entry_data;
       break;
     case ENTRY_PI22:
-      fluid_cell_ptr->pi[2][2] = entry_data;
+      fluid_cell.pi[2][2] = entry_data;
       break;
     case ENTRY_PI23:
-      fluid_cell_ptr->pi[2][3] = entry_data;
-      fluid_cell_ptr->pi[3][2] = entry_data;
+      fluid_cell.pi[2][3] = entry_data;
+      fluid_cell.pi[3][2] = entry_data;
       break;
     case ENTRY_PI33:
-      fluid_cell_ptr->pi[3][3] = entry_data;
+      fluid_cell.pi[3][3] = entry_data;
       break;
     case ENTRY_BULK_PI:
-      fluid_cell_ptr->bulk_Pi = entry_data;
+      fluid_cell.bulk_Pi = entry_data;
       break;
     default:
       JSWARN << "The entry name in data_info_ must be one of the \
@@ -230,7 +239,7 @@ FluidCellInfo EvolutionHistory::GetFluidCell(int id_tau, int id_x, int id_y,
     }
   }
 
-  return *fluid_cell_ptr;
+  return fluid_cell;
 }
 
 /** For one given time step id_tau,
@@ -298,4 +307,443 @@ FluidCellInfo EvolutionHistory::get_tz(Jetscape::real t, Jetscape::real x,
   return (get(tau, x, y, eta));
 }
 
+// ----------------------------------------------------------------------
+// Adaptive sparse storage
+
+namespace {
+
+const int nSparseFields = 27;
+
+void CellFields(const FluidCellInfo &cell, Jetscape::real *f) {
+  f[0] = cell.energy_density;
+  f[1] = cell.entropy_density;
+  f[2] = cell.temperature;
+  f[3] = cell.pressure;
+  f[4] = cell.qgp_fraction;
+  f[5] = cell.mu_B;
+  f[6] = cell.mu_C;
+  f[7] = cell.mu_S;
+  f[8] = cell.vx;
+  f[9] = cell.vy;
+  f[10] = cell.vz;
+  for (int i = 0; i < 4; i++) {
+    for (int j = 0; j < 4; j++) {
+      f[11 + 4 * i + j] = cell.pi[i][j];
+    }
+  }
+  f[26] = cell.bulk_Pi;
+}
+
+// Largest deviation between two cells, in units of the field scales.
+// Nodes below T_min in both cells count as vacuum and always agree.
+Jetscape::real CellDeviation(const FluidCellInfo &exact,
+                             const FluidCellInfo &approx,
+                             const Jetscape::real *scales,
+                             Jetscape::real T_min) {
+  if (exact.temperature < T_min && approx.temperature < T_min) {
+    return 0.;
+  }
+  Jetscape::real fa[nSparseFields], fb[nSparseFields];
+  CellFields(exact, fa);
+  CellFields(approx, fb);
+  Jetscape::real deviation = 0.;
+  for (int k = 0; k < nSparseFields; k++) {
+    deviation = std::max(deviation, std::abs(fa[k] - fb[k]) / scales[k]);
+  }
+  return deviation;
+}
+
+// Multilinear interpolation between the 8 corners of a block
+FluidCellInfo BlockInterpolation(const FluidCellInfo *corners,
+                                 Jetscape::real fx, Jetscape::real fy,
+                                 Jetscape::real feta) {
+  FluidCellInfo result;
+  for (int c = 0; c < 8; c++) {
+    Jetscape::real w = ((c & 4) ? fx : 1. - fx) * ((c & 2) ? fy : 1. - fy) *
+                       ((c & 1) ? feta : 1. - feta);
+    if (w != 0.) {
+      result = result + w * corners[c];
+    }
+  }
+  return result;
+}
+
+// Quantities that vanish everywhere are compared in absolute terms
+void NonzeroScales(const std::vector<Jetscape::real> &scales,
+                   Jetscape::real *nonzero) {
+  for (int k = 0; k < nSparseFields; k++) {
+    nonzero[k] = scales[k] > 0. ? scales[k] : 1.;
+  }
+}
+
+Jetscape::real BlockFraction(int i, int start, int end) {
+  return (end > start ? static_cast<Jetscape::real>(i - start) / (end - start)
+                      : 0.);
+}
+
+} // namespace
+
+// Keeps the filling mode, so that a producer can restart its history
+void EvolutionHistory::ClearSparseStorage() {
+  sparse_ = false;
+  sparse_tau_.clear();
+  sparse_tau_slot_.clear();
+  sparse_slices_.clear();
+  std::fill(sparse_scales_.begin(), sparse_scales_.end(), 0.);
+  sparse_added_tau_ = 0;
+  data_first_tau_ = 0;
+  sparse_candidate_tau_ = -1;
+  sparse_candidate_ = SparseEvolutionSlice();
+}
+
+void EvolutionHistory::InitSparseStorage(Jetscape::real T_min,
+                                         Jetscape::real tolerance,
+                                         int block_size, int max_tau_stride) {
+  ClearSparseStorage();
+  sparse_T_min_ = T_min;
+  sparse_tolerance_ = tolerance;
+  sparse_block_size_ = std::max(block_size, 1);
+  sparse_max_tau_stride_ = std::max(max_tau_stride, 1);
+  auto n_blocks = [this](int n) {
+    return std::max((n - 1 + sparse_block_size_ - 1) / sparse_block_size_, 1);
+  };
+  sparse_nbx_ = n_blocks(nx);
+  sparse_nby_ = n_blocks(ny);
+  sparse_nbeta_ = n_blocks(std::max(neta, 1));
+  sparse_scales_.assign(nSparseFields, 0.);
+}
+
+// Blocks span the nodes [start, end]; neighbouring blocks share a face.
+void EvolutionHistory::SparseBlockRange(int id_block, int n, int &start,
+                                        int &end) const {
+  start = id_block * sparse_block_size_;
+  end = std::min(start + sparse_block_size_, std::max(n - 1, 0));
+}
+
+SparseEvolutionSlice
+EvolutionHistory::SparsifySlice(int id_tau, Jetscape::real T_min,
+                                Jetscape::real tolerance,
+                                const Jetscape::real *scales) const {
+  int n_eta = std::max(neta, 1);
+  SparseEvolutionSlice slice;
+  slice.offset.assign(sparse_nbx_ * sparse_nby_ * sparse_nbeta_, -1);
+  slice.coarse.assign(slice.offset.size(), 0);
+
+  std::vector<FluidCellInfo> block;
+  for (int bx = 0; bx < sparse_nbx_; bx++) {
+    for (int by = 0; by < sparse_nby_; by++) {
+      for (int beta = 0; beta < sparse_nbeta_; beta++) {
+        int x0, x1, y0, y1, eta0, eta1;
+        SparseBlockRange(bx, nx, x0, x1);
+        SparseBlockRange(by, ny, y0, y1);
+        SparseBlockRange(beta, n_eta, eta0, eta1);
+
+        block.clear();
+        bool all_cold = true;
+        for (int ix = x0; ix <= x1; ix++) {
+          for (int iy = y0; iy <= y1; iy++) {
+            for (int ieta = eta0; ieta <= eta1; ieta++) {
+              block.push_back(GetFluidCell(id_tau, ix, iy, ieta));
+              all_cold = all_cold && block.back().temperature < T_min;
+            }
+          }
+        }
+
+        int id_block = (bx * sparse_nby_ + by) * sparse_nbeta_ + beta;
+        if (all_cold) {
+          continue;
+        }
+
+        // Try to represent the block by its corners
+        FluidCellInfo corners[8];
+        int ny_block = y1 - y0 + 1, neta_block = eta1 - eta0 + 1;
+        for (int c = 0; c < 8; c++) {
+          int lx = (c & 4) ? x1 - x0 : 0;
+          int ly = (c & 2) ? y1 - y0 : 0;
+          int leta = (c & 1) ? eta1 - eta0 : 0;
+          corners[c] = block[(lx * ny_block + ly) * neta_block + leta];
+        }
+        bool coarse = true;
+        for (int ix = x0; ix <= x1 && coarse; ix++) {
+          for (int iy = y0; iy <= y1 && coarse; iy++) {
+            for (int ieta = eta0; ieta <= eta1 && coarse; ieta++) {
+              auto approx = BlockInterpolation(
+                  corners, BlockFraction(ix, x0, x1),
+                  BlockFraction(iy, y0, y1), BlockFraction(ieta, eta0, eta1));
+              const auto &exact =
+                  block[((ix - x0) * ny_block + iy - y0) * neta_block + ieta -
+                        eta0];
+              coarse = CellDeviation(exact, approx, scales, T_min) <=
+                       tolerance;
+            }
+          }
+        }
+
+        slice.offset[id_block] = slice.cells.size();
+        if (coarse) {
+          slice.coarse[id_block] = 1;
+          slice.cells.insert(slice.cells.end(), corners, corners + 8);
+        } else {
+          slice.cells.insert(slice.cells.end(), block.begin(), block.end());
+        }
+      }
+    }
+  }
+  slice.cells.shrink_to_fit();
+  return slice;
+}
+
+void EvolutionHistory::PlaceInMemory() const {
+  JetScapeMemoryPlacement::Place(data);
+  for (const auto &slice : sparse_slices_) {
+    JetScapeMemoryPlacement::Place(slice.cells);
+  }
+}
+
+void EvolutionHistory::Sparsify(Jetscape::real T_min,
+                                Jetscape::real tolerance, int block_size,
+                                int max_tau_stride) {
+  if (sparse_ || sparse_filling_ || ntau <= 0 || nx <= 0 || ny <= 0) {
+    return;
+  }
+  InitSparseStorage(T_min, tolerance, block_size, max_tau_stride);
+
+  // The error is measured relative to the largest value of each quantity
+  sparse_running_scales_ = false;
+  for (int it = 0; it < ntau; it++) {
+    UpdateSparseScales(it);
+  }
+
+  std::size_t dense_bytes = GetMemoryFootprint();
+  for (int it = 0; it < ntau; it++) {
+    AddSparseTauSlice(it);
+  }
+  FinalizeSparseStorage(dense_bytes);
+}
+
+void EvolutionHistory::StartSparseFilling(Jetscape::real T_min,
+                                          Jetscape::real tolerance,
+                                          int block_size, int max_tau_stride) {
+  sparse_filling_ = true;
+  sparse_running_scales_ = true;
+  sparse_T_min_ = T_min;
+  sparse_tolerance_ = tolerance;
+  sparse_block_size_ = std::max(block_size, 1);
+  sparse_max_tau_stride_ = std::max(max_tau_stride, 1);
+  ClearSparseStorage();
+}
+
+void EvolutionHistory::SparsifyFilledSlices() {
+  if (!sparse_filling_ || nx <= 0 || ny <= 0) {
+    return;
+  }
+  if (sparse_added_tau_ == 0) {
+    // the grid is known once the first slice arrives
+    InitSparseStorage(sparse_T_min_, sparse_tolerance_, sparse_block_size_,
+                      sparse_max_tau_stride_);
+  }
+  std::size_t slice_size = GetTauSliceSize();
+  while (data.size() >=
+         (sparse_added_tau_ - data_first_tau_ + 1) * slice_size) {
+    AddSparseTauSlice(sparse_added_tau_);
+  }
+}
+
+void EvolutionHistory::FinishSparseFilling() {
+  if (!sparse_filling_) {
+    return;
+  }
+  if (sparse_added_tau_ == 0) {
+    // the producer filled the history in one go, or not at all
+    sparse_filling_ = false;
+    if (data.empty() && data_vector.empty()) {
+      return;
+    }
+    Sparsify(sparse_T_min_, sparse_tolerance_, sparse_block_size_,
+             sparse_max_tau_stride_);
+    return;
+  }
+  SparsifyFilledSlices();
+  if (sparse_added_tau_ != ntau) {
+    JSWARN << "Sparse evolution history: " << sparse_added_tau_
+           << " tau slices filled, but ntau = " << ntau;
+    ntau = sparse_added_tau_;
+  }
+  sparse_filling_ = false;
+  FinalizeSparseStorage(0);
+}
+
+void EvolutionHistory::UpdateSparseScales(int id_tau) {
+  Jetscape::real f[nSparseFields];
+  for (int ix = 0; ix < nx; ix++) {
+    for (int iy = 0; iy < ny; iy++) {
+      for (int ieta = 0; ieta < std::max(neta, 1); ieta++) {
+        CellFields(GetFluidCell(id_tau, ix, iy, ieta), f);
+        for (int k = 0; k < nSparseFields; k++) {
+          sparse_scales_[k] = std::max(sparse_scales_[k], std::abs(f[k]));
+        }
+      }
+    }
+  }
+}
+
+// Slices arrive in tau order. The first one is stored, every later one is
+// the candidate for the next stored slice for as long as the slices since
+// the last stored one can be interpolated linearly between the two.
+void EvolutionHistory::AddSparseTauSlice(int id_tau) {
+  if (sparse_running_scales_) {
+    UpdateSparseScales(id_tau);
+  }
+  Jetscape::real scales[nSparseFields];
+  NonzeroScales(sparse_scales_, scales);
+
+  SparseEvolutionSlice slice =
+      SparsifySlice(id_tau, sparse_T_min_, sparse_tolerance_, scales);
+  sparse_added_tau_ = id_tau + 1;
+  if (sparse_tau_.empty()) {
+    sparse_candidate_tau_ = id_tau;
+    sparse_candidate_ = std::move(slice);
+    KeepSparseCandidate();
+    return;
+  }
+  if (sparse_candidate_tau_ >= 0 && !SparseInterpolates(id_tau, slice)) {
+    KeepSparseCandidate();
+  }
+  sparse_candidate_tau_ = id_tau;
+  sparse_candidate_ = std::move(slice);
+}
+
+bool EvolutionHistory::SparseInterpolates(
+    int id_tau, const SparseEvolutionSlice &slice) const {
+  int it_last = sparse_tau_.back();
+  if (id_tau - it_last > sparse_max_tau_stride_) {
+    return false;
+  }
+  Jetscape::real scales[nSparseFields];
+  NonzeroScales(sparse_scales_, scales);
+  for (int it = it_last + 1; it < id_tau; it++) {
+    Jetscape::real w =
+        static_cast<Jetscape::real>(it - it_last) / (id_tau - it_last);
+    for (int ix = 0; ix < nx; ix++) {
+      for (int iy = 0; iy < ny; iy++) {
+        for (int ieta = 0; ieta < std::max(neta, 1); ieta++) {
+          auto approx =
+              (1. - w) * GetSparseNode(sparse_slices_.back(), ix, iy, ieta) +
+              w * GetSparseNode(slice, ix, iy, ieta);
+          if (CellDeviation(GetFluidCell(it, ix, iy, ieta), approx, scales,
+                            sparse_T_min_) > sparse_tolerance_) {
+            return false;
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Stores the candidate. While filling, the dense slices up to it are no
+// longer needed for the interpolation checks and are dropped.
+void EvolutionHistory::KeepSparseCandidate() {
+  sparse_tau_.push_back(sparse_candidate_tau_);
+  sparse_slices_.push_back(std::move(sparse_candidate_));
+  sparse_candidate_ = SparseEvolutionSlice();
+  if (sparse_filling_) {
+    std::size_t n_drop =
+        (sparse_candidate_tau_ + 1 - data_first_tau_) * GetTauSliceSize();
+    data.erase(data.begin(), data.begin() + std::min(n_drop, data.size()));
+    data_first_tau_ = sparse_candidate_tau_ + 1;
+  }
+  sparse_candidate_tau_ = -1;
+}
+
+void EvolutionHistory::FinalizeSparseStorage(std::size_t dense_bytes) {
+  if (sparse_candidate_tau_ >= 0) {
+    KeepSparseCandidate();
+  }
+  sparse_tau_slot_.resize(ntau);
+  for (unsigned int slot = 0; slot < sparse_tau_.size(); slot++) {
+    int it_end = slot + 1 < sparse_tau_.size() ? sparse_tau_[slot + 1] : ntau;
+    for (int it = sparse_tau_[slot]; it < it_end; it++) {
+      sparse_tau_slot_[it] = slot;
+    }
+  }
+
+  std::vector<FluidCellInfo>().swap(data);
+  std::vector<float>().swap(data_vector);
+  data_info.clear();
+  data_first_tau_ = 0;
+  sparse_ = true;
+
+  if (dense_bytes > 0) {
+    JSINFO << "Sparse evolution history: " << sparse_tau_.size() << " of "
+           << ntau << " tau slices stored, " << dense_bytes / 1048576.
+           << " MB -> " << GetMemoryFootprint() / 1048576. << " MB";
+  } else {
+    JSINFO << "Sparse evolution history filled: " << sparse_tau_.size()
+           << " of " << ntau << " tau slices stored, "
+           << GetMemoryFootprint() / 1048576. << " MB";
+  }
+}
+
+std::size_t EvolutionHistory::GetMemoryFootprint() const {
+  if (!sparse_) {
+    return (data.capacity() * sizeof(FluidCellInfo) +
+            data_vector.capacity() * sizeof(float));
+  }
+  std::size_t bytes = sparse_tau_slot_.capacity() * sizeof(int);
+  for (const auto &slice : sparse_slices_) {
+    bytes += slice.cells.capacity() * sizeof(FluidCellInfo) +
+             slice.offset.capacity() * sizeof(int) + slice.coarse.capacity();
+  }
+  return bytes;
+}
+
+FluidCellInfo EvolutionHistory::GetSparseNode(const SparseEvolutionSlice &slice,
+                                              int id_x, int id_y,
+                                              int id_eta) const {
+  int n_eta = std::max(neta, 1);
+  id_x = std::min(nx - 1, std::max(0, id_x));
+  id_y = std::min(ny - 1, std::max(0, id_y));
+  id_eta = std::min(n_eta - 1, std::max(0, id_eta));
+
+  int bx = std::min(id_x / sparse_block_size_, sparse_nbx_ - 1);
+  int by = std::min(id_y / sparse_block_size_, sparse_nby_ - 1);
+  int beta = std::min(id_eta / sparse_block_size_, sparse_nbeta_ - 1);
+  int id_block = (bx * sparse_nby_ + by) * sparse_nbeta_ + beta;
+  int offset = slice.offset[id_block];
+  if (offset < 0) {
+    return FluidCellInfo();
+  }
+
+  int x0, x1, y0, y1, eta0, eta1;
+  SparseBlockRange(bx, nx, x0, x1);
+  SparseBlockRange(by, ny, y0, y1);
+  SparseBlockRange(beta, n_eta, eta0, eta1);
+  if (slice.coarse[id_block]) {
+    return BlockInterpolation(&slice.cells[offset],
+                              BlockFraction(id_x, x0, x1),
+                              BlockFraction(id_y, y0, y1),
+                              BlockFraction(id_eta, eta0, eta1));
+  }
+  return slice.cells[offset + ((id_x - x0) * (y1 - y0 + 1) + id_y - y0) *
+                                  (eta1 - eta0 + 1) +
+                     id_eta - eta0];
+}
+
+FluidCellInfo EvolutionHistory::GetSparseFluidCell(int id_tau, int id_x,
+                                                   int id_y,
+                                                   int id_eta) const {
+  id_tau = std::min(ntau - 1, std::max(0, id_tau));
+  int slot = sparse_tau_slot_[id_tau];
+  auto cell0 = GetSparseNode(sparse_slices_[slot], id_x, id_y, id_eta);
+  if (sparse_tau_[slot] == id_tau) {
+    return cell0;
+  }
+  // tau slices in between stored ones are interpolated linearly
+  Jetscape::real w = static_cast<Jetscape::real>(id_tau - sparse_tau_[slot]) /
+                     (sparse_tau_[slot + 1] - sparse_tau_[slot]);
+  auto cell1 = GetSparseNode(sparse_slices_[slot + 1], id_x, id_y, id_eta);
+  return (1. - w) * cell0 + w * cell1;
+}
+
 } // end namespace Jetscape
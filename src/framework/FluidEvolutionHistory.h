@@ -17,6 +17,7 @@
 #ifndef EVOLUTIONHISTORY_H
 #define EVOLUTIONHISTORY_H
 
+#include <algorithm>
 #include <vector>
 #include <stdexcept>
 #include "FluidCellInfo.h"
@@ -72,6 +73,17 @@ class InvalidSpaceTimeRange : public std::invalid_argument {
   using std::invalid_argument::invalid_argument;
 };
 
+/** One tau slice of the sparse storage, see EvolutionHistory::Sparsify().
+ * The spatial lattice is split into blocks whose corner nodes are shared
+ * with their neighbours. A block is either vacuum (not stored), coarse
+ * (only its corners are stored and the nodes in between are interpolated)
+ * or dense (all its nodes are stored). */
+struct SparseEvolutionSlice {
+  std::vector<int> offset;          //!< first cell of a block, -1 for vacuum
+  std::vector<unsigned char> coarse; //!< 1 if only the corners are stored
+  std::vector<FluidCellInfo> cells;
+};
+
 class EvolutionHistory {
 public:
   /** @param tau_min Minimum value of tau.*/
@@ -129,9 +141,15 @@ public:
     data_info.clear();
   }
 
-  void clear_up_evolution_data() { data.clear(); }
+  void clear_up_evolution_data() {
+    data.clear();
+    ClearSparseStorage();
+  }
 
-  int get_data_size() const { return (data.size()); }
+  /** Number of lattice cells, also when they are stored sparsely. */
+  int get_data_size() const {
+    return (sparse_ ? ntau * nx * ny * std::max(neta, 1) : data.size());
+  }
   bool is_boost_invariant() const { return (boost_invariant); }
   bool is_Cartesian() const { return (tau_eta_is_tz); }
 
@@ -257,6 +275,89 @@ public:
                     Jetscape::real etas) const;
   FluidCellInfo get_tz(Jetscape::real t, Jetscape::real x, Jetscape::real y,
                        Jetscape::real z) const;
+
+  /** Replace the dense lattice by an adaptive sparse storage.
+     * Lookups stay transparent. Every lattice node with a temperature of
+     * at least T_min is reproduced with an error of at most
+     * tolerance * (maximum of the quantity in the evolution), for every
+     * quantity of FluidCellInfo. Blocks of nodes all below T_min are
+     * dropped and read as vacuum cells (FluidCellInfo()).
+     @param T_min Temperature below which a node counts as vacuum [GeV].
+     @param tolerance Relative error bound, see above.
+     @param block_size Number of lattice spacings per block and direction.
+     @param max_tau_stride Maximum number of tau steps between stored slices.
+    */
+  void Sparsify(Jetscape::real T_min, Jetscape::real tolerance,
+                int block_size, int max_tau_stride);
+
+  /** Build the sparse storage while the history is being filled, so that
+     * the dense lattice never exists in full. Same parameters as
+     * Sparsify(), but the errors are measured relative to the largest
+     * values among the tau slices filled so far. The producer sets the
+     * grid (ntau, nx, ny, neta) and appends the tau slices to data in
+     * order, calling SparsifyFilledSlices() after each one or a few; only
+     * the slices not yet decided on (at most max_tau_stride) stay dense.
+    */
+  void StartSparseFilling(Jetscape::real T_min, Jetscape::real tolerance,
+                          int block_size, int max_tau_stride);
+
+  /** Move the complete tau slices at the end of data to the sparse
+     * storage. Does nothing unless StartSparseFilling() was called. */
+  void SparsifyFilledSlices();
+
+  /** Store the remaining slices and switch to the sparse lookups. A
+     * producer that did not call SparsifyFilledSlices() is sparsified as
+     * a whole, like Sparsify(). */
+  void FinishSparseFilling();
+
+  bool is_sparse() const { return (sparse_); }
+  bool is_sparse_filling() const { return (sparse_filling_); }
+
+  /** Number of cells in one tau slice. */
+  int GetTauSliceSize() const { return (nx * ny * std::max(neta, 1)); }
+
+  /** Applies JetScapeMemoryPlacement to the stored cells. */
+  void PlaceInMemory() const;
+
+  /** Approximate memory used by the stored cells, in bytes. */
+  std::size_t GetMemoryFootprint() const;
+
+private:
+  void ClearSparseStorage();
+  void InitSparseStorage(Jetscape::real T_min, Jetscape::real tolerance,
+                         int block_size, int max_tau_stride);
+  void UpdateSparseScales(int id_tau);
+  void AddSparseTauSlice(int id_tau);
+  bool SparseInterpolates(int id_tau,
+                          const SparseEvolutionSlice &slice) const;
+  void KeepSparseCandidate();
+  void FinalizeSparseStorage(std::size_t dense_bytes);
+  void SparseBlockRange(int id_block, int n, int &start, int &end) const;
+  SparseEvolutionSlice SparsifySlice(int id_tau, Jetscape::real T_min,
+                                     Jetscape::real tolerance,
+                                     const Jetscape::real *scales) const;
+  FluidCellInfo GetSparseNode(const SparseEvolutionSlice &slice, int id_x,
+                              int id_y, int id_eta) const;
+  FluidCellInfo GetSparseFluidCell(int id_tau, int id_x, int id_y,
+                                   int id_eta) const;
+
+  bool sparse_ = false;
+  int sparse_block_size_ = 1;
+  int sparse_nbx_ = 0, sparse_nby_ = 0, sparse_nbeta_ = 0;
+  std::vector<int> sparse_tau_;      //!< tau ids of the stored slices
+  std::vector<int> sparse_tau_slot_; //!< stored slice at or below each tau id
+  std::vector<SparseEvolutionSlice> sparse_slices_;
+
+  // state while the sparse storage is being built
+  bool sparse_filling_ = false;
+  Jetscape::real sparse_T_min_ = 0., sparse_tolerance_ = 0.;
+  int sparse_max_tau_stride_ = 1;
+  std::vector<Jetscape::real> sparse_scales_;
+  bool sparse_running_scales_ = false; //!< scales of the slices seen so far
+  int sparse_added_tau_ = 0;           //!< tau slices added so far
+  int data_first_tau_ = 0;             //!< tau id of data[0]
+  int sparse_candidate_tau_ = -1;      //!< last slice, not decided on yet
+  SparseEvolutionSlice sparse_candidate_;
 };
 
 } // namespace Jetscape
@@ -15,10 +15,12 @@
 
 #include "Hadronization.h"
 #include "JetScapeLogger.h"
+#include "JetScapeXML.h"
 #include <string>
 #include <vector>
 #include <iostream>
 #include "JetScapeSignalManager.h"
+#include "JetScapeTaskSupport.h"
 #include "JetScapeWriterStream.h"
 
 using namespace std;
@@ -51,7 +53,23 @@ void Hadronization::Init() {
 
   JSINFO << "Found " << GetNumberOfTasks()
          << " Hadronization Tasks/Modules Initialize them ... ";
+  if (variant_element_) {
+    JSINFO << "Hadronization variant " << variant_;
+    JetScapeXML::Instance()->SetOverride("JetHadronization", variant_element_);
+  }
+  // as in JetEnergyLoss, the modules of a variant get an engine of their own
+  if (!variant_.empty()) {
+    variant_generator_ = make_shared<std::mt19937>();
+    JetScapeTaskSupport::SeedVariantGenerator(
+        *variant_generator_, "JetHadronization", variant_, GetCurrentEvent());
+    for (auto hadroModule : GetTaskList()) {
+      auto module = dynamic_pointer_cast<JetScapeModuleBase>(hadroModule);
+      if (module)
+        module->SetMt19937Generator(variant_generator_);
+    }
+  }
   JetScapeTask::InitTasks();
+  JetScapeXML::Instance()->SetOverride("", nullptr);
 }
 
 void Hadronization::DoHadronize() {
@@ -73,16 +91,24 @@ void Hadronization::Exec() {
   //this->outHadrons = make_shared<vector<shared_ptr<Hadron>>>();
   //this->outPartons = make_shared<vector<shared_ptr<Parton>>>();
 
+  if (variant_generator_)
+    JetScapeTaskSupport::SeedVariantGenerator(
+        *variant_generator_, "JetHadronization", variant_, GetCurrentEvent());
+
   DoHadronize();
 }
 
 void Hadronization::WriteTask(weak_ptr<JetScapeWriter> w) {
   VERBOSE(4) << "In Hadronization::WriteTask";
   auto f = w.lock();
-  if (!f)
+  if (!f || f->GetVariant() != variant_)
     return;
 
-  f->WriteComment("Hadronization module: " + GetId());
+  if (variant_.empty())
+    f->WriteComment("Hadronization module: " + GetId());
+  else
+    f->WriteComment("Hadronization module: " + GetId() + ", variant " +
+                    variant_);
 
   if (GetHadrons().size() > 0) {
     f->WriteComment("Final State Hadrons");
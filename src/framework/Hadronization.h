@@ -90,6 +90,15 @@ public:
   // erases the outHadrons with positive status flag
   void DeleteRealHadrons();
 
+  // A variant hadronizes the same partons with the children of its <Variant>
+  // element overriding <JetHadronization> parameters during Init, and writes
+  // only to the writers of that variant. Empty name is the main run.
+  void SetVariant(string name, tinyxml2::XMLElement *element) {
+    variant_ = name;
+    variant_element_ = element;
+  }
+  string GetVariant() const { return variant_; }
+
 private:
   vector<vector<shared_ptr<Parton>>> inPartons;
   vector<shared_ptr<Hadron>> outHadrons;
@@ -99,6 +108,10 @@ private:
   bool TransformPartonsConnected;
   bool HydroHyperSurfaceConnected_;
   bool GetHydroCellSignalConnected_;
+
+  string variant_;
+  tinyxml2::XMLElement *variant_element_ = nullptr;
+  shared_ptr<std::mt19937> variant_generator_;
 };
 
 } // namespace Jetscape
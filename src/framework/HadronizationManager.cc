@@ -50,7 +50,7 @@ void HadronizationManager::Clear() {
   hd.clear();
 
   int n = GetNumberOfTasks();
-  for (int i = 1; i < n; i++)
+  for (int i = n_configured_tasks; i < n; i++)
     EraseTaskLast();
 
   JetScapeSignalManager::Instance()->CleanUp();
@@ -68,6 +68,7 @@ void HadronizationManager::Init() {
 
   JSINFO << "Found " << GetNumberOfTasks()
          << " Hadronization Manager Tasks/Modules Initialize them ... ";
+  n_configured_tasks = GetNumberOfTasks();
   JetScapeTask::InitTasks();
 
   JSINFO << "Connect HadronizationManager Signal to Energy Loss ...";
@@ -100,9 +101,18 @@ void HadronizationManager::Exec() {
                << " partons ready for hadronization";
     VERBOSE(2) << " There are already " << hadrons.size() << " hadrons";
 
+    // tasks of an Eloss variant hadronize the showers of that variant
+    auto eloss =
+        JetScapeSignalManager::Instance()->GetEnergyLossPointer().lock();
     for (auto it : GetTaskList()) {
-      dynamic_pointer_cast<Hadronization>(it)->AddInPartons(hd);
-      dynamic_pointer_cast<Hadronization>(it)->AddInHadrons(hadrons);
+      auto hadro = dynamic_pointer_cast<Hadronization>(it);
+      vector<vector<shared_ptr<Parton>>> hdVariant;
+      if (eloss && !hadro->GetVariant().empty() &&
+          eloss->SendVariantFinalStatePartons(hadro->GetVariant(), hdVariant))
+        hadro->AddInPartons(hdVariant);
+      else
+        hadro->AddInPartons(hd);
+      hadro->AddInHadrons(hadrons);
     }
     JetScapeTask::ExecuteTasks();
   } else {
@@ -143,6 +153,8 @@ void HadronizationManager::GetHadrons(vector<shared_ptr<Hadron>>& signal){
 		vector<shared_ptr<Hadron>> tempHadronList;
 		JetScapeTask *jet = it.get();
 		Hadronization *hit = (Hadronization *) jet;
+		if (!hit->GetVariant().empty())
+			continue;
 		tempHadronList = hit->GetHadrons();
 		for(auto hadron : tempHadronList){
 			signal.push_back(hadron);
@@ -155,6 +167,8 @@ void HadronizationManager::DeleteHadrons() {
 	for(shared_ptr<JetScapeTask> it : GetTaskList()){
 		JetScapeTask *jet = it.get();
 		Hadronization *hit = (Hadronization *) jet;
+		if (!hit->GetVariant().empty())
+			continue;
 		hit->DeleteHadrons();
 	}
 }
@@ -164,6 +178,8 @@ void HadronizationManager::DeleteRealHadrons() {
 	for(shared_ptr<JetScapeTask> it : GetTaskList()){
 		JetScapeTask *jet = it.get();
 		Hadronization *hit = (Hadronization *) jet;
+		if (!hit->GetVariant().empty())
+			continue;
 		hit->DeleteRealHadrons();
 	}
 }
@@ -44,7 +44,7 @@ public:
 
   void CreateSignalSlots();
 
-		//get Hadrons from Hadronization submodules
+		//get Hadrons from Hadronization submodules of the main run (no variants)
   void GetHadrons(vector<shared_ptr<Hadron>>& signal);
 
   // deletes the hadrons from the different hadronization modules
@@ -77,6 +77,7 @@ private:
   bool GetHadronListConnected;
   vector<vector<shared_ptr<Parton>>> hd;
   vector<shared_ptr<Hadron>> hadrons;
+  int n_configured_tasks = 1; // main run plus variants, kept by Clear()
 };
 
 } // end namespace Jetscape
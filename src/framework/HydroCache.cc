@@ -0,0 +1,270 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "HydroCache.h"
+#include "JetScapeLogger.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <tuple>
+#include <type_traits>
+
+namespace fs = std::filesystem;
+
+namespace Jetscape {
+
+namespace {
+
+const std::uint64_t fnvPrime = 0x100000001b3ULL;
+const char cacheMagic[8] = {'J', 'S', 'H', 'Y', 'D', 'R', 'O', 'C'};
+const std::uint32_t cacheFormatVersion = 1;
+const char *cacheExtension = ".jshydro";
+
+struct CacheFileHeader {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t real_size;
+  char key[32];
+  double tau_min, dtau, x_min, dx, y_min, dy, eta_min, deta;
+  std::int32_t ntau, nx, ny, neta;
+  std::int32_t tau_eta_is_tz, boost_invariant;
+  std::uint64_t n_cells, n_surface;
+  std::uint64_t checksum;
+};
+
+static_assert(std::is_trivially_copyable<FluidCellInfo>::value,
+              "FluidCellInfo is stored as raw bytes");
+static_assert(std::is_trivially_copyable<SurfaceCellInfo>::value,
+              "SurfaceCellInfo is stored as raw bytes");
+
+// FNV-1a over 8-byte words; only guards against damaged files
+std::uint64_t Checksum(const void *data, std::size_t size, std::uint64_t h) {
+  const char *bytes = static_cast<const char *>(data);
+  std::size_t n_words = size / 8;
+  for (std::size_t i = 0; i < n_words; i++) {
+    std::uint64_t word;
+    std::memcpy(&word, bytes + 8 * i, 8);
+    h = (h ^ word) * fnvPrime;
+  }
+  for (std::size_t i = 8 * n_words; i < size; i++) {
+    h = (h ^ static_cast<unsigned char>(bytes[i])) * fnvPrime;
+  }
+  return h;
+}
+
+} // end anonymous namespace
+
+void HydroCacheDigest::Add(const void *data, std::size_t size) {
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  for (std::size_t i = 0; i < size; i++) {
+    h1_ = (h1_ ^ bytes[i]) * fnvPrime;
+    h2_ = (h2_ ^ bytes[i]) * fnvPrime;
+    h2_ ^= h2_ >> 29;
+  }
+}
+
+void HydroCacheDigest::Add(const std::string &text) {
+  std::uint64_t size = text.size();
+  Add(&size, sizeof(size));
+  Add(text.data(), text.size());
+}
+
+std::string HydroCacheDigest::Hex() const {
+  std::ostringstream hex;
+  hex << std::hex << std::setfill('0') << std::setw(16) << h1_
+      << std::setw(16) << h2_;
+  return hex.str();
+}
+
+HydroCache::HydroCache(const std::string &directory, double max_size_in_GB)
+    : directory_(directory),
+      max_size_(static_cast<std::uintmax_t>(max_size_in_GB * 1e9)) {
+  std::error_code ec;
+  fs::create_directories(directory_, ec);
+  if (ec) {
+    JSWARN << "Cannot create the hydro cache directory " << directory_
+           << ": " << ec.message();
+  }
+}
+
+std::string HydroCache::PathFor(const std::string &key) const {
+  return (fs::path(directory_) / (key + cacheExtension)).string();
+}
+
+bool HydroCache::Load(const std::string &key, EvolutionHistory &history,
+                      std::vector<SurfaceCellInfo> &surface) const {
+  std::string path = PathFor(key);
+  std::ifstream in(path, std::ios::binary);
+  if (!in.good())
+    return false;
+
+  CacheFileHeader header;
+  in.read(reinterpret_cast<char *>(&header), sizeof(header));
+  if (!in || std::memcmp(header.magic, cacheMagic, sizeof(cacheMagic)) != 0 ||
+      header.version != cacheFormatVersion ||
+      header.real_size != sizeof(Jetscape::real) ||
+      key.compare(0, key.size(), header.key, sizeof(header.key)) != 0) {
+    JSWARN << "Ignoring hydro cache file " << path
+           << " written in another format or for another key";
+    return false;
+  }
+
+  std::vector<FluidCellInfo> cells(header.n_cells);
+  std::vector<SurfaceCellInfo> surface_cells(header.n_surface);
+  in.read(reinterpret_cast<char *>(cells.data()),
+          cells.size() * sizeof(FluidCellInfo));
+  in.read(reinterpret_cast<char *>(surface_cells.data()),
+          surface_cells.size() * sizeof(SurfaceCellInfo));
+  std::uint64_t checksum =
+      Checksum(cells.data(), cells.size() * sizeof(FluidCellInfo),
+               fnvPrime);
+  checksum = Checksum(surface_cells.data(),
+                      surface_cells.size() * sizeof(SurfaceCellInfo),
+                      checksum);
+  in.close();
+  if (!in || checksum != header.checksum) {
+    JSWARN << "Hydro cache file " << path
+           << " failed its integrity check, removing it";
+    std::error_code ec;
+    fs::remove(path, ec);
+    return false;
+  }
+
+  history.clear_up_evolution_data();
+  history.tau_min = header.tau_min;
+  history.dtau = header.dtau;
+  history.x_min = header.x_min;
+  history.dx = header.dx;
+  history.y_min = header.y_min;
+  history.dy = header.dy;
+  history.eta_min = header.eta_min;
+  history.deta = header.deta;
+  history.ntau = header.ntau;
+  history.nx = header.nx;
+  history.ny = header.ny;
+  history.neta = header.neta;
+  history.tau_eta_is_tz = header.tau_eta_is_tz;
+  history.boost_invariant = header.boost_invariant;
+  history.data.swap(cells);
+  surface.swap(surface_cells);
+
+  // mark the entry as recently used for the eviction
+  std::error_code ec;
+  fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+  return true;
+}
+
+void HydroCache::Store(const std::string &key, const EvolutionHistory &history,
+                       const std::vector<SurfaceCellInfo> &surface) const {
+  if (history.is_sparse()) {
+    JSWARN << "Sparse evolution histories are not cached";
+    return;
+  }
+  CacheFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, cacheMagic, sizeof(cacheMagic));
+  header.version = cacheFormatVersion;
+  header.real_size = sizeof(Jetscape::real);
+  key.copy(header.key, sizeof(header.key));
+  header.tau_min = history.tau_min;
+  header.dtau = history.dtau;
+  header.x_min = history.x_min;
+  header.dx = history.dx;
+  header.y_min = history.y_min;
+  header.dy = history.dy;
+  header.eta_min = history.eta_min;
+  header.deta = history.deta;
+  header.ntau = history.ntau;
+  header.nx = history.nx;
+  header.ny = history.ny;
+  header.neta = history.neta;
+  header.tau_eta_is_tz = history.tau_eta_is_tz;
+  header.boost_invariant = history.boost_invariant;
+  header.n_cells = history.data.size();
+  header.n_surface = surface.size();
+  header.checksum = Checksum(history.data.data(),
+                             history.data.size() * sizeof(FluidCellInfo),
+                             fnvPrime);
+  header.checksum = Checksum(surface.data(),
+                             surface.size() * sizeof(SurfaceCellInfo),
+                             header.checksum);
+
+  // write under a private name and rename, so readers never see half a file
+  std::string path = PathFor(key);
+  std::ostringstream tmp_path;
+  tmp_path << path << ".tmp." << getpid();
+  std::ofstream out(tmp_path.str(), std::ios::binary | std::ios::trunc);
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char *>(history.data.data()),
+            history.data.size() * sizeof(FluidCellInfo));
+  out.write(reinterpret_cast<const char *>(surface.data()),
+            surface.size() * sizeof(SurfaceCellInfo));
+  out.close();
+
+  std::error_code ec;
+  if (!out) {
+    JSWARN << "Cannot write the hydro cache file " << tmp_path.str();
+    fs::remove(tmp_path.str(), ec);
+    return;
+  }
+  fs::rename(tmp_path.str(), path, ec);
+  if (ec) {
+    JSWARN << "Cannot move the hydro cache file to " << path << ": "
+           << ec.message();
+    fs::remove(tmp_path.str(), ec);
+    return;
+  }
+  VERBOSE(2) << "Stored hydro evolution in " << path;
+
+  Evict();
+}
+
+void HydroCache::Evict() const {
+  std::vector<std::tuple<fs::file_time_type, std::uintmax_t, fs::path>> files;
+  std::uintmax_t total_size = 0;
+  std::error_code ec;
+  for (auto &entry : fs::directory_iterator(directory_, ec)) {
+    if (entry.path().extension() != cacheExtension)
+      continue;
+    std::error_code entry_ec;
+    std::uintmax_t size = entry.file_size(entry_ec);
+    auto time = entry.last_write_time(entry_ec);
+    if (entry_ec)
+      continue;
+    total_size += size;
+    files.emplace_back(time, size, entry.path());
+  }
+  if (total_size <= max_size_)
+    return;
+
+  // least recently used first
+  std::sort(files.begin(), files.end());
+  for (auto &file : files) {
+    if (total_size <= max_size_)
+      break;
+    if (fs::remove(std::get<2>(file), ec)) {
+      total_size -= std::get<1>(file);
+      VERBOSE(2) << "Evicted " << std::get<2>(file) << " from the hydro cache";
+    }
+  }
+}
+
+} // end namespace Jetscape
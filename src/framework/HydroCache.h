@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#ifndef HYDROCACHE_H
+#define HYDROCACHE_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "FluidEvolutionHistory.h"
+#include "SurfaceCellInfo.h"
+
+namespace Jetscape {
+
+/** 128-bit digest (two FNV-1a streams) used to address cache entries. */
+class HydroCacheDigest {
+public:
+  void Add(const void *data, std::size_t size);
+  void Add(const std::string &text);
+  template <typename T> void Add(const std::vector<T> &v) {
+    Add(v.data(), v.size() * sizeof(T));
+  }
+  /** @return The digest as 32 hex characters. */
+  std::string Hex() const;
+
+private:
+  std::uint64_t h1_ = 0xcbf29ce484222325ULL;
+  std::uint64_t h2_ = 0x84222325cbf29ce4ULL;
+};
+
+/** Content-addressed on-disk cache of finished hydro evolutions, shared by
+ *  jobs that point to the same directory. Each entry is one file named by
+ *  its key. Files carry a checksum of their payload, are written under a
+ *  temporary name and renamed into place, and the least recently used
+ *  ones are removed once the directory grows beyond the size limit.
+ */
+class HydroCache {
+public:
+  HydroCache(const std::string &directory, double max_size_in_GB);
+
+  /** Fills history and surface from the entry for key.
+      @return false, leaving both untouched, if there is no valid entry. */
+  bool Load(const std::string &key, EvolutionHistory &history,
+            std::vector<SurfaceCellInfo> &surface) const;
+
+  /** Writes an entry for key and evicts old entries if needed. */
+  void Store(const std::string &key, const EvolutionHistory &history,
+             const std::vector<SurfaceCellInfo> &surface) const;
+
+  const std::string &GetDirectory() const { return directory_; }
+
+private:
+  std::string PathFor(const std::string &key) const;
+  void Evict() const;
+
+  std::string directory_;
+  std::uintmax_t max_size_;
+};
+
+} // end namespace Jetscape
+
+#endif // HYDROCACHE_H
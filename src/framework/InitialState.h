@@ -101,7 +101,7 @@ public:
   /**  @return The initial state entropy density distribution.
        @sa Function CoordFromIdx(int idx) for mapping of the index of the vector entropy_density_distribution_ to the fluid cell at location (x, y, z or eta).
   */
-  inline std::vector<double> GetEntropyDensityDistribution() {
+  inline const std::vector<double> &GetEntropyDensityDistribution() const {
     return entropy_density_distribution_;
   };
 
@@ -14,6 +14,7 @@
  ******************************************************************************/
 
 #include <iostream>
+#include <iterator>
 #include <thread>
 //#include <mutex>
 //#include <condition_variable>
@@ -25,6 +26,7 @@
 #include <string>
 #include "tinyxml2.h"
 #include "JetScapeSignalManager.h"
+#include "JetScapeTaskSupport.h"
 #include "JetScapeWriterStream.h"
 #include "HardProcess.h"
 #include "JetScapeModuleMutex.h"
@@ -81,6 +83,10 @@ JetEnergyLoss::JetEnergyLoss(const JetEnergyLoss &j) {
   deltaT = j.deltaT;
   maxT = j.maxT;
 
+  variant_ = j.variant_;
+  variant_element_ = j.variant_element_;
+  variant_generator_ = j.variant_generator_;
+
   inP = nullptr;
   pShower = nullptr;
 
@@ -89,6 +95,9 @@ JetEnergyLoss::JetEnergyLoss(const JetEnergyLoss &j) {
     // Working via CRTP JetEnergyLossModule Clone function !
     auto st = dynamic_pointer_cast<JetEnergyLoss>(it)
                   ->Clone(); //shared ptr with clone !!????
+    // copies of a variant keep drawing from the engine of the variant
+    if (variant_generator_)
+      st->SetMt19937Generator(variant_generator_);
     Add(st);
   }
 }
@@ -99,6 +108,8 @@ void JetEnergyLoss::Clear() {
     pShower->clear();
 
   this->final_Partons.clear();
+  for (auto &showers : variant_final_Partons)
+    showers.second.clear();
 
   inP = nullptr;
 }
@@ -110,6 +121,11 @@ void JetEnergyLoss::Init() {
 
   deltaT = GetXMLElementDouble({"Eloss", "deltaT"});
 
+  if (!variant_.empty())
+    JSINFO << "Eloss variant " << variant_;
+  if (variant_element_)
+    JetScapeXML::Instance()->SetOverride("Eloss", variant_element_);
+
   maxT = GetXMLElementDouble({"Eloss", "maxT"});
   JSINFO << "Eloss shower with deltaT = " << deltaT << " and maxT = " << maxT;
 
@@ -141,7 +157,27 @@ void JetEnergyLoss::Init() {
   JSINFO << "Found " << GetNumberOfTasks()
          << " Eloss Tasks/Modules Initialize them ... ";
 
+  // The modules of a variant share an engine of their own, so they do not
+  // draw from (and shift) the engines of the main run
+  if (!variant_.empty()) {
+    variant_generator_ = make_shared<std::mt19937>();
+    JetScapeTaskSupport::SeedVariantGenerator(*variant_generator_, "Eloss",
+                                              variant_, GetCurrentEvent());
+    for (auto elossModule : GetTaskList()) {
+      auto module = dynamic_pointer_cast<JetScapeModuleBase>(elossModule);
+      if (module)
+        module->SetMt19937Generator(variant_generator_);
+    }
+  }
+
   JetScapeTask::InitTasks();
+  JetScapeXML::Instance()->SetOverride("", nullptr);
+}
+
+void JetEnergyLoss::SeedVariantGenerator(int event) {
+  if (variant_generator_)
+    JetScapeTaskSupport::SeedVariantGenerator(*variant_generator_, "Eloss",
+                                              variant_, event);
 }
 
 void JetEnergyLoss::DoShower() {
@@ -151,15 +187,17 @@ void JetEnergyLoss::DoShower() {
   VERBOSESHOWER(8) << "Hard Parton from Initial Hard Process ...";
   VERBOSEPARTON(6, *GetShowerInitiatingParton());
 
-  // consider pointers for speed up ...
-  vector<Parton> pIn;
+  // Each active parton lives in its own slot, which is handed to the eloss
+  // modules as their pIn and updated there in place. Partons are copied
+  // only when the shower graph gains an edge or a daughter is emitted.
+  vector<vector<Parton>> pIn;
   // DEBUG this guy isn't linked to anything - put in test particle for now
-  pIn.push_back(*GetShowerInitiatingParton());
+  pIn.emplace_back(1, *GetShowerInitiatingParton());
 
   vector<node> vStartVec;
   // Add here the Hard Shower emitting parton ...
-  vStart = pShower->new_vertex(make_shared<Vertex>());
-  vEnd = pShower->new_vertex(make_shared<Vertex>());
+  vStart = pShower->new_vertex(MakeEventShared<Vertex>());
+  vEnd = pShower->new_vertex(MakeEventShared<Vertex>());
   // Add original parton later, after it had a chance to acquire virtuality
   // pShower->new_parton(vStart,vEnd,make_shared<Parton>(*GetShowerInitiatingParton()));
 
@@ -178,23 +216,27 @@ void JetEnergyLoss::DoShower() {
     miss_stat = liquefier_ptr.lock()->get_miss_stat();
     neg_stat = liquefier_ptr.lock()->get_neg_stat();
   }
+  // buffers reused from one time step to the next
+  vector<vector<Parton>> pInTemp; // slots that go on
+  vector<vector<Parton>> pOut;    // daughters emitted in this step
+  vector<Parton> pOutTemp;
+  vector<node> vStartVecOut;
+  vector<node> vStartVecTemp;
   do {
-    vector<Parton> pOut;
-    vector<Parton> pInTemp;
-
-    vector<node> vStartVecOut;
-    vector<node> vStartVecTemp;
+    pInTemp.clear();
+    pOut.clear();
+    vStartVecOut.clear();
+    vStartVecTemp.clear();
 
     VERBOSESHOWER(7) << "Current time = " << currentTime << " with #Input "
                      << pIn.size();
     currentTime += deltaT;
 
-    for (int i = 0; i < pIn.size(); i++) {
-      vector<Parton> pInTempModule;
-      vector<Parton> pOutTemp;
-      // JSINFO << pIn.at(i).edgeid();
-      pInTempModule.push_back(pIn[i]);
-      SentInPartons(deltaT, currentTime, pIn[i].pt(), pInTempModule, pOutTemp);
+    for (unsigned int i = 0; i < pIn.size(); i++) {
+      vector<Parton> &pInTempModule = pIn[i];
+      pOutTemp.clear();
+      SentInPartons(deltaT, currentTime, pInTempModule[0].pt(), pInTempModule,
+                    pOutTemp);
 
       // apply liquefier
       if (!weak_ptr_is_uninitialized(liquefier_ptr)) {
@@ -208,10 +250,20 @@ void JetEnergyLoss::DoShower() {
         // cerr << " ---------------------------------------------- "
         //      << endl;
         pShower->new_parton(vStart, vEnd,
-                            make_shared<Parton>(pInTempModule.at(0)));
+                            MakeEventShared<Parton>(pInTempModule.at(0)));
         foundchangedorig = true;
       }
 
+      // the graph copies remember the module that produced them, so that
+      // writers can attribute every parton to its module
+      const string producer = pInTempModule[0].GetController();
+      auto graph_parton = [&producer](const Parton &p) {
+        auto copy = MakeEventShared<Parton>(p);
+        if (!producer.empty())
+          copy->SetController(producer);
+        return copy;
+      };
+
       vStart = vStartVec[i];
       if (pOutTemp.size() == 0) {
         // no need to generate a vStart for photons and liquefied
@@ -236,14 +288,14 @@ void JetEnergyLoss::DoShower() {
           int edgeid = 0;
           if (pOutTemp[k].pstat() == neg_stat) {
             node vNewRootNode = pShower->new_vertex(
-                make_shared<Vertex>(0, 0, 0, currentTime - deltaT));
+                MakeEventShared<Vertex>(0, 0, 0, currentTime - deltaT));
             edgeid = pShower->new_parton(vNewRootNode, vStart,
-                                         make_shared<Parton>(pOutTemp[k]));
+                                         graph_parton(pOutTemp[k]));
           } else {
-            vEnd =
-                pShower->new_vertex(make_shared<Vertex>(0, 0, 0, currentTime));
+            vEnd = pShower->new_vertex(
+                MakeEventShared<Vertex>(0, 0, 0, currentTime));
             edgeid = pShower->new_parton(vStart, vEnd,
-                                         make_shared<Parton>(pOutTemp[k]));
+                                         graph_parton(pOutTemp[k]));
           }
           pOutTemp[k].set_shower(pShower);
           pOutTemp[k].set_edgeid(edgeid);
@@ -273,9 +325,9 @@ void JetEnergyLoss::DoShower() {
 
             for (int l = 1; l < pInTempModule.size(); l++) {
               node vNewRootNode = pShower->new_vertex(
-                  make_shared<Vertex>(0, 0, 0, currentTime - deltaT));
+                  MakeEventShared<Vertex>(0, 0, 0, currentTime - deltaT));
               pShower->new_parton(vNewRootNode, vEnd,
-                                  make_shared<Parton>(pInTempModule[l]));
+                                  graph_parton(pInTempModule[l]));
             }
           }
         }
@@ -296,7 +348,9 @@ void JetEnergyLoss::DoShower() {
         // do not push back photons
         if (pInTempModule[0].isPhoton(pInTempModule[0].pid()))
           continue;
-        pInTemp.push_back(pInTempModule[0]);
+        // keep the slot as updated by the modules
+        pInTempModule.erase(pInTempModule.begin() + 1, pInTempModule.end());
+        pInTemp.push_back(std::move(pInTempModule));
       } else if (pOutTemp.size() == 1) {
         // this is the free-streaming case for MARTINI or LBT
         // do not push back droplets
@@ -311,7 +365,9 @@ void JetEnergyLoss::DoShower() {
         // do not push back photons
         if (pOutTemp[0].isPhoton(pOutTemp[0].pid()))
           continue;
-        pInTemp.push_back(pOutTemp[0]);
+        // the propagated parton takes over the slot
+        pInTempModule.swap(pOutTemp);
+        pInTemp.push_back(std::move(pInTempModule));
       } else {
         for (int k = 0; k < pOutTemp.size(); k++) {
           // do not push back droplets
@@ -330,20 +386,18 @@ void JetEnergyLoss::DoShower() {
           if (pOutTemp[k].isPhoton(pOutTemp[k].pid()))
             continue;
 
-          pOut.push_back(pOutTemp[k]);
+          pOut.emplace_back(1, pOutTemp[k]);
         }
       }
     }
 
     // one time step is finished, now update parton shower to pIn
-    pIn.clear();
-    pIn.insert(pIn.end(), pInTemp.begin(), pInTemp.end());
-    pIn.insert(pIn.end(), pOut.begin(), pOut.end());
+    pIn.swap(pInTemp);
+    pIn.insert(pIn.end(), std::make_move_iterator(pOut.begin()),
+               std::make_move_iterator(pOut.end()));
 
     // update vertex vector
-    vStartVec.clear();
-    vStartVec.insert(vStartVec.end(), vStartVecTemp.begin(),
-                     vStartVecTemp.end());
+    vStartVec.swap(vStartVecTemp);
     vStartVec.insert(vStartVec.end(), vStartVecOut.begin(), vStartVecOut.end());
   } while (currentTime < maxT); // other criteria (how to include; TBD)
 
@@ -392,14 +446,14 @@ void JetEnergyLoss::Exec() {
 
     shared_ptr<PartonPrinter> pPrinter =
         JetScapeSignalManager::Instance()->GetPartonPrinterPointer().lock();
-    if (pPrinter) {
+    if (pPrinter && variant_.empty()) {
       pPrinter->GetFinalPartons(pShower);
     }
 
     shared_ptr<JetEnergyLoss> pEloss =
         JetScapeSignalManager::Instance()->GetEnergyLossPointer().lock();
     if (pEloss) {
-      pEloss->GetFinalPartonsForEachShower(pShower);
+      pEloss->GetFinalPartonsForEachShower(pShower, variant_);
     }
   } else {
     JSWARN << "NO Initial Hard Parton for Parton shower received ...";
@@ -416,7 +470,11 @@ void JetEnergyLoss::WriteTask(weak_ptr<JetScapeWriter> w) {
   if (!f)
     return;
 
-  f->WriteComment("Energy loss Shower Initating Parton: " + GetId());
+  if (variant_.empty())
+    f->WriteComment("Energy loss Shower Initating Parton: " + GetId());
+  else
+    f->WriteComment("Energy loss Shower Initating Parton: " + GetId() +
+                    ", variant " + variant_);
   f->Write(inP);
 
   VERBOSE(4) << " writing partons... found " << pShower->GetNumberOfPartons();
@@ -428,9 +486,21 @@ void JetEnergyLoss::PrintShowerInitiatingParton() {
 }
 
 void JetEnergyLoss::GetFinalPartonsForEachShower(
-    shared_ptr<PartonShower> shower) {
+    shared_ptr<PartonShower> shower, const string &variant) {
+
+  if (variant.empty())
+    this->final_Partons.push_back(shower.get()->GetFinalPartons());
+  else
+    variant_final_Partons[variant].push_back(shower.get()->GetFinalPartons());
+}
 
-  this->final_Partons.push_back(shower.get()->GetFinalPartons());
+bool JetEnergyLoss::SendVariantFinalStatePartons(
+    const string &variant, vector<vector<shared_ptr<Parton>>> &fPartons) {
+  auto showers = variant_final_Partons.find(variant);
+  if (showers == variant_final_Partons.end())
+    return false;
+  fPartons = showers->second;
+  return true;
 }
 
 } // end namespace Jetscape
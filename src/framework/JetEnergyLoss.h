@@ -25,6 +25,7 @@
 #include "PartonPrinter.h"
 #include "MakeUniqueHelper.h"
 #include "LiquefierBase.h"
+#include <map>
 #include <vector>
 #include <random>
 
@@ -212,7 +213,36 @@ public:
     fPartons = final_Partons;
   }
 
-  void GetFinalPartonsForEachShower(shared_ptr<PartonShower> shower);
+  /** Collects the final partons of a shower, by variant (empty for the main run).
+   */
+  void GetFinalPartonsForEachShower(shared_ptr<PartonShower> shower,
+                                    const string &variant = "");
+
+  /** Final partons of the showers of an Eloss variant.
+      @return False if there is no such Eloss variant in this event.
+   */
+  bool SendVariantFinalStatePartons(const string &variant,
+                                    vector<vector<shared_ptr<Parton>>> &fPartons);
+
+  /** A variant showers its own copy of the hard partons, with the children of
+      its <Variant> element overriding <Eloss> parameters during Init. Its showers
+      do not feed the liquefier or the parton printer.
+      @param name Variant name, empty for the main run.
+      @param element The <Variant> element.
+   */
+  void SetVariant(string name, tinyxml2::XMLElement *element) {
+    variant_ = name;
+    variant_element_ = element;
+  }
+
+  /** @return The variant name, empty for the main run.
+   */
+  string GetVariant() const { return variant_; }
+
+  /** Reseeds the engine shared by the modules of a variant for an event.
+      The main run keeps drawing from the engines of its task numbers.
+   */
+  void SeedVariantGenerator(int event);
 
 protected:
   std::weak_ptr<LiquefierBase> liquefier_ptr;
@@ -243,6 +273,11 @@ private:
   // Vector of final state partons for each shower as a vector
 
   vector<vector<shared_ptr<Parton>>> final_Partons;
+  std::map<string, vector<vector<shared_ptr<Parton>>>> variant_final_Partons;
+
+  string variant_;
+  tinyxml2::XMLElement *variant_element_ = nullptr;
+  shared_ptr<std::mt19937> variant_generator_;
 };
 
 } // end namespace Jetscape
@@ -17,7 +17,9 @@
 #include "JetScapeLogger.h"
 #include "JetScapeSignalManager.h"
 #include "MakeUniqueHelper.h"
+#include "JetScapeEventMemory.h"
 #include <string>
+#include <algorithm>
 
 #include <iostream>
 #include <vector>
@@ -48,7 +50,7 @@ void JetEnergyLossManager::Clear() {
   hp.clear();
 
   int n = GetNumberOfTasks();
-  for (int i = 1; i < n; i++)
+  for (int i = n_configured_tasks; i < n; i++)
     EraseTaskLast();
 
   // Clean Up not really working with iterators (see also above!!!) Some logic not clear for me.
@@ -68,6 +70,7 @@ void JetEnergyLossManager::Init() {
 
   JSINFO << "Found " << GetNumberOfTasks()
          << " Eloss Manager Tasks/Modules Initialize them ... ";
+  n_configured_tasks = GetNumberOfTasks();
   JetScapeTask::InitTasks();
 
   JSINFO << "Connect JetEnergyLossManager Signal to Hard Process ...";
@@ -75,17 +78,36 @@ void JetEnergyLossManager::Init() {
       shared_from_this());
 
   // Set the pointer of JetEnergyLoss for making connections to hadronization module
+  // (the main run collects the final partons of the variants as well)
+  variants.clear();
   for (auto it : GetTaskList()) {
-    if (dynamic_pointer_cast<JetEnergyLoss>(it))
-
-      JetScapeSignalManager::Instance()->SetEnergyLossPointer(
-          dynamic_pointer_cast<JetEnergyLoss>(it));
+    auto jloss = dynamic_pointer_cast<JetEnergyLoss>(it);
+    if (!jloss)
+      continue;
+    if (jloss->GetVariant().empty())
+      JetScapeSignalManager::Instance()->SetEnergyLossPointer(jloss);
+    else
+      variants.push_back(jloss->GetVariant());
   }
 }
 
 void JetEnergyLossManager::WriteTask(weak_ptr<JetScapeWriter> w) {
   VERBOSE(8);
-  JetScapeTask::WriteTasks(w);
+  // as JetScapeTask::WriteTasks, but each writer only gets the tasks of its
+  // variant; writers of hadronization variants share the main showers
+  if (!GetActive())
+    return;
+
+  auto f = w.lock();
+  string variant = f ? f->GetVariant() : "";
+  if (std::find(variants.begin(), variants.end(), variant) == variants.end())
+    variant = "";
+
+  for (auto it : GetTaskList()) {
+    auto jloss = dynamic_pointer_cast<JetEnergyLoss>(it);
+    if (!jloss || jloss->GetVariant() == variant)
+      it->WriteTask(w);
+  }
 }
 
 void JetEnergyLossManager::Exec() {
@@ -97,27 +119,35 @@ void JetEnergyLossManager::Exec() {
     exit(-1);
   }
 
+  // each event starts the Eloss variants on a fresh stream of their own
+  for (int t = 0; t < n_configured_tasks; t++)
+    dynamic_pointer_cast<JetEnergyLoss>(GetTaskAt(t))
+        ->SeedVariantGenerator(JetScapeModuleBase::GetCurrentEvent());
+
   // ----------------------------------
   // Create needed copies and connect signal/slots accordingly ...
 
   if (GetGetHardPartonListConnected()) {
     GetHardPartonList(hp);
     VERBOSE(3) << " Number of Hard Partons = " << hp.size();
-    for (int i = 1; i < hp.size(); i++) {
-      JSDEBUG << "Create the " << i
-              << " th copy because number of intital hard partons = "
-              << hp.size();
-      // Add(make_shared<JetEnergyLoss>(*dynamic_pointer_cast<JetEnergyLoss>(GetTaskAt(0))));
-      auto jloss_org = dynamic_pointer_cast<JetEnergyLoss>(GetTaskAt(0));
-      auto jloss_copy = make_shared<JetEnergyLoss>(*jloss_org);
-
-      // if there is a liquefier attached to the jloss module
-      // also attach the liquefier to the copied jloss modules
-      // to collect hydrodynamic source terms
-      if (!weak_ptr_is_uninitialized(jloss_org->get_liquefier())) {
-        jloss_copy->add_a_liquefier(jloss_org->get_liquefier().lock());
+    // copies of the main run first, then those of each Eloss variant
+    for (int t = 0; t < n_configured_tasks; t++) {
+      auto jloss_org = dynamic_pointer_cast<JetEnergyLoss>(GetTaskAt(t));
+      for (unsigned int i = 1; i < hp.size(); i++) {
+        JSDEBUG << "Create the " << i
+                << " th copy because number of intital hard partons = "
+                << hp.size();
+        // Add(make_shared<JetEnergyLoss>(*dynamic_pointer_cast<JetEnergyLoss>(GetTaskAt(0))));
+        auto jloss_copy = make_shared<JetEnergyLoss>(*jloss_org);
+
+        // if there is a liquefier attached to the jloss module
+        // also attach the liquefier to the copied jloss modules
+        // to collect hydrodynamic source terms
+        if (!weak_ptr_is_uninitialized(jloss_org->get_liquefier())) {
+          jloss_copy->add_a_liquefier(jloss_org->get_liquefier().lock());
+        }
+        Add(jloss_copy);
       }
-      Add(jloss_copy);
     }
   }
 
@@ -134,8 +164,16 @@ void JetEnergyLossManager::Exec() {
   if (GetGetHardPartonListConnected() && hp.size() > 0) {
     int n = 0;
     for (auto it : GetTaskList()) {
-      dynamic_pointer_cast<JetEnergyLoss>(it)->AddShowerInitiatingParton(
-          hp.at(n));
+      // the configured tasks take the first parton, their copies the others
+      int i = n < n_configured_tasks
+                  ? 0
+                  : 1 + (n - n_configured_tasks) % ((int)hp.size() - 1);
+      auto jloss = dynamic_pointer_cast<JetEnergyLoss>(it);
+      // variants get their own copy, so that no shower changes another's
+      if (jloss->GetVariant().empty())
+        jloss->AddShowerInitiatingParton(hp.at(i));
+      else
+        jloss->AddShowerInitiatingParton(MakeEventShared<Parton>(*hp.at(i)));
       n++;
     }
   }
@@ -168,8 +206,14 @@ void JetEnergyLossManager::Exec() {
 
     for (auto it : GetTaskList()) {
       if (it->GetActive()) {
-        threads.push_back(thread(&JetEnergyLoss::Exec,
-                                 dynamic_pointer_cast<JetEnergyLoss>(it)));
+        // keep allocating from the event memory pool in the worker
+        bool inEvent = JetScapeEventMemory::InEvent();
+        threads.push_back(thread(
+            [inEvent](shared_ptr<JetEnergyLoss> eloss) {
+              JetScapeEventMemory::AttachThread(inEvent);
+              eloss->Exec();
+            },
+            dynamic_pointer_cast<JetEnergyLoss>(it)));
         n++;
       }
       if (n == nMaxThreads) {
@@ -52,6 +52,7 @@ public:
   virtual void Clear();
 
   /** It writes the output information relevant to the jet energy loss tasks/subtasks into a file. It can be overridden by other tasks.
+      Writers of an Eloss variant receive the showers of that variant, all others the showers of the main run.
       @param w A pointer of type JetScapeWriter class.
       @sa JetScapeWriter class for further information. 
   */
@@ -84,6 +85,8 @@ public:
 private:
   bool GetHardPartonListConnected;
   vector<shared_ptr<Parton>> hp;
+  int n_configured_tasks = 1; // main run plus Eloss variants, kept by Clear()
+  vector<string> variants;    // names of the Eloss variants
 };
 
 } // end namespace Jetscape
@@ -19,10 +19,14 @@
 #include "JetEnergyLossManager.h"
 #include "FluidDynamics.h"
 #include "JetScapeBanner.h"
+#include "JetScapeEventMemory.h"
+#include "JetScapeMemoryPlacement.h"
 #include "InitialState.h"
 #include "PreequilibriumDynamics.h"
 #include "JetEnergyLoss.h"
 #include "CausalLiquefier.h"
+#include "HardProcess.h"
+#include "HadronizationManager.h"
 
 #ifdef USE_HEPMC
 #include "JetScapeWriterHepMC.h"
@@ -32,8 +36,16 @@
 #endif
 
 #include <iostream>
+#include <cstdio>
+#include <functional>
+#include <map>
 #include <string>
+#include <sstream>
 #include <vector>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include <algorithm>
 
 using namespace std;
@@ -45,7 +57,8 @@ namespace Jetscape {
    */
 JetScape::JetScape()
     : JetScapeModuleBase(), n_events(1), n_events_printout(100), reuse_hydro_(false), n_reuse_hydro_(1),
-      liquefier(nullptr), fEnableAutomaticTaskListDetermination(true) {
+      use_run_monitor_(false), fork_workers_(0), fork_max_restarts_(0),
+      is_fork_parent_(false), liquefier(nullptr), fEnableAutomaticTaskListDetermination(true) {
   VERBOSE(8);
   SetId("primary");
 }
@@ -87,6 +100,28 @@ void JetScape::Init() {
   // So --> JetScape is "Task Manager" of all modules ...
   JSINFO << "Found " << GetNumberOfTasks() << " Modules Initialize them ... ";
   SetPointers();
+
+  // Writers open their files in the workers, one set per worker
+  if (fork_workers_ > 0) {
+    for (auto it : GetTaskList()) {
+      if (dynamic_pointer_cast<JetScapeWriter>(it) && it->GetActive()) {
+        it->SetActive(false);
+        fork_writers_.push_back(dynamic_pointer_cast<JetScapeWriter>(it));
+#ifdef USE_HEPMC
+        // HepMC writers already opened the unsuffixed file, which stays empty
+        bool hepmc = dynamic_pointer_cast<JetScapeWriterHepMC>(it) != nullptr;
+#ifdef USE_ROOT
+        hepmc = hepmc || dynamic_pointer_cast<JetScapeWriterRootHepMC>(it);
+#endif
+        if (hepmc) {
+          fork_writers_.back()->Close();
+          std::remove(fork_writers_.back()->GetOutputFileName().c_str());
+        }
+#endif
+      }
+    }
+  }
+
   JSINFO << "Calling JetScape InitTasks()...";
   JetScapeTask::InitTasks();
 }
@@ -194,6 +229,50 @@ void JetScape::ReadGeneralParametersFromXML() {
     JSINFO << "nReuseHydro: " << nReuseHydro;
   }
 
+  // Optional precision-targeted run termination
+  use_run_monitor_ = GetXMLElementInt({"StopCriteria", "enabled"}, false) > 0;
+  if (use_run_monitor_) {
+    run_monitor_.SetTargetRelativeError(
+        GetXMLElementDouble({"StopCriteria", "targetRelativeError"}));
+    std::istringstream edges_stream(
+        GetXMLElementText({"StopCriteria", "pTBinEdges"}));
+    std::vector<double> edges;
+    double edge;
+    while (edges_stream >> edge) {
+      edges.push_back(edge);
+    }
+    run_monitor_.SetPtBinEdges(edges);
+    run_monitor_.SetEtaMax(GetXMLElementDouble({"StopCriteria", "etaMax"}));
+    run_monitor_.SetMinEvents(GetXMLElementInt({"StopCriteria", "minEvents"}));
+    run_monitor_.SetMaxWallTime(
+        GetXMLElementDouble({"StopCriteria", "maxWallTimeInSeconds"}));
+    JSINFO << "Stop criteria: target relative error = "
+           << run_monitor_.GetTargetRelativeError() << " in "
+           << run_monitor_.GetNumberOfBins() << " pT bins, wall-time budget = "
+           << GetXMLElementDouble({"StopCriteria", "maxWallTimeInSeconds"})
+           << " s";
+    if (run_monitor_.GetTargetRelativeError() > 0 &&
+        run_monitor_.GetNumberOfBins() == 0) {
+      JSWARN << "StopCriteria: targetRelativeError is set but fewer than two "
+                "pTBinEdges are given; only the wall-time budget applies.";
+    }
+  }
+
+  // Optional fork server: initialize once, run the events in forked workers
+  if (GetXMLElementInt({"ForkServer", "enabled"}, false) > 0) {
+    fork_workers_ = GetXMLElementInt({"ForkServer", "nWorkers"});
+    fork_max_restarts_ = GetXMLElementInt({"ForkServer", "maxRestarts"});
+    if (fork_workers_ < 1 || fork_max_restarts_ < 0) {
+      JSWARN << "ForkServer: need nWorkers >= 1 and maxRestarts >= 0";
+      throw std::runtime_error("Incompatible fork server settings.");
+    }
+    JSINFO << "Fork server: " << fork_workers_ << " workers, up to "
+           << fork_max_restarts_ << " restarts each";
+  }
+
+  // Huge pages, NUMA interleaving and thread pinning for large tables
+  JetScapeMemoryPlacement::ReadFromXML();
+
   // Set up helper. Mostly used for random numbers
   // Needs the XML reader singleton set up
   JetScapeTaskSupport::ReadSeedFromXML();
@@ -220,6 +299,11 @@ void JetScape::DetermineTaskListFromXML() {
     elementXML = elementXML->NextSiblingElement();
   }
 
+  // Eloss and hadronization variants are created once all other modules
+  // are, so that the task numbers of the main run, and with them its random
+  // engines, do not depend on whether variants are configured
+  std::vector<std::function<void()>> addVariants;
+
   // Loop through and create all modules
   tinyxml2::XMLElement *element =
       (tinyxml2::XMLElement *)JetScapeXML::Instance()
@@ -551,11 +635,13 @@ void JetScape::DetermineTaskListFromXML() {
       }
 
       // Loop through and add Eloss modules
+      std::vector<std::string> elossModuleNames;
       tinyxml2::XMLElement *childElement =
           (tinyxml2::XMLElement *)element->FirstChildElement();
       while (childElement) {
         std::string childElementName = childElement->Name();
         VERBOSE(2) << "Parsing childElement: " << childElementName;
+        int nModules = jloss->GetNumberOfTasks();
 
         //   - Matter
         if (childElementName == "Matter") {
@@ -607,10 +693,32 @@ void JetScape::DetermineTaskListFromXML() {
           }
         }
 
+        if (jloss->GetNumberOfTasks() > nModules)
+          elossModuleNames.push_back(childElementName);
         childElement = childElement->NextSiblingElement();
       }
 
       jlossmanager->Add(jloss);
+
+      // Variants shower copies of the same hard partons in the same medium
+      // with other parameters. They have no liquefier, so the medium only
+      // sees the main showers.
+      addVariants.push_back([this, jlossmanager, elossModuleNames]() {
+        for (auto &variant : ReadVariantsFromXML("Eloss")) {
+          auto jlossVariant = make_shared<JetEnergyLoss>();
+          jlossVariant->SetVariant(variant.first, variant.second);
+          for (auto &moduleName : elossModuleNames) {
+            auto elossModule = JetScapeModuleFactory::createInstance(moduleName);
+            if (elossModule)
+              jlossVariant->Add(elossModule);
+          }
+          jlossmanager->Add(jlossVariant);
+          eloss_variants_.push_back(variant.first);
+          JSINFO << "JetScape::DetermineTaskList() -- Eloss: Added variant "
+                 << variant.first << " with "
+                 << jlossVariant->GetNumberOfTasks() << " modules.";
+        }
+      });
       Add(jlossmanager);
     }
 
@@ -624,43 +732,60 @@ void JetScape::DetermineTaskListFromXML() {
       // Determine type of hadronization module, and add it
       std::string hadronizationName =
           element->FirstChildElement("name")->GetText();
-      if (hadronizationName == "colored") {
-        auto hadroModule =
-            JetScapeModuleFactory::createInstance("ColoredHadronization");
-        if (hadroModule) {
-          hadro->Add(hadroModule);
-          JSINFO << "JetScape::DetermineTaskList() -- JetHadronization: Added "
-                    "ColoredHadronization to task list.";
-        }
-      } else if (hadronizationName == "colorless") {
-        auto hadroModule =
-            JetScapeModuleFactory::createInstance("ColorlessHadronization");
+      auto addModule = [hadronizationName](shared_ptr<Hadronization> task) {
+        std::string moduleName;
+        if (hadronizationName == "colored")
+          moduleName = "ColoredHadronization";
+        else if (hadronizationName == "colorless")
+          moduleName = "ColorlessHadronization";
+        else if (hadronizationName == "hybrid")
+          moduleName = "HybridHadronization";
+        //   - Custom module
+        else if (((int)hadronizationName.find("CustomModule") >= 0))
+          moduleName = hadronizationName;
+        if (moduleName.empty())
+          return;
+        auto hadroModule = JetScapeModuleFactory::createInstance(moduleName);
         if (hadroModule) {
-          hadro->Add(hadroModule);
+          task->Add(hadroModule);
           JSINFO << "JetScape::DetermineTaskList() -- JetHadronization: Added "
-                    "ColorlessHadronization to task list.";
+                 << moduleName << " to task list"
+                 << (task->GetVariant().empty()
+                         ? std::string(".")
+                         : " (variant " + task->GetVariant() + ").");
         }
-      } else if (hadronizationName == "hybrid") {
-        auto hadroModule =
-            JetScapeModuleFactory::createInstance("HybridHadronization");
-        if (hadroModule) {
-          hadro->Add(hadroModule);
-          JSINFO << "JetScape::DetermineTaskList() -- JetHadronization: Added "
-                    "HybridHadronization to task list.";
+      };
+      addModule(hadro);
+      hadroMgr->Add(hadro);
+
+      // Variants hadronize the same partons with other parameters
+      addVariants.push_back([this, hadroMgr, addModule]() {
+        std::vector<std::string> elossVariants;
+        for (auto &variant : ReadVariantsFromXML("Eloss"))
+          elossVariants.push_back(variant.first);
+        for (auto &variant : ReadVariantsFromXML("JetHadronization")) {
+          if (std::find(elossVariants.begin(), elossVariants.end(),
+                        variant.first) != elossVariants.end()) {
+            JSWARN << "Hadronization variant " << variant.first
+                   << " has the name of an Eloss variant, it is ignored.";
+            continue;
+          }
+          auto hadroVariant = make_shared<Hadronization>();
+          hadroVariant->SetVariant(variant.first, variant.second);
+          addModule(hadroVariant);
+          hadroMgr->Add(hadroVariant);
+          hadronization_variants_.push_back(variant.first);
         }
-      }
-      //   - Custom module
-      else if (((int)hadronizationName.find("CustomModule") >= 0)) {
-        auto customModule =
-            JetScapeModuleFactory::createInstance(hadronizationName);
-        if (customModule) {
-          hadro->Add(customModule);
-          JSINFO << "JetScape::DetermineTaskList() -- JetHadronization: Added "
-                 << hadronizationName << " to task list.";
+
+        // Showers of Eloss variants are hadronized with the main parameters
+        for (auto &variant : elossVariants) {
+          auto hadroVariant = make_shared<Hadronization>();
+          hadroVariant->SetVariant(variant, nullptr);
+          addModule(hadroVariant);
+          hadroMgr->Add(hadroVariant);
         }
-      }
+      });
 
-      hadroMgr->Add(hadro);
       Add(hadroMgr);
     }
 
@@ -761,12 +886,25 @@ void JetScape::DetermineTaskListFromXML() {
       }
     }
 
+    // Hadron decays, acting on the hadrons of the tasks added before
+    else if (elementName == "HadronDecays") {
+      auto hadronDecays = JetScapeModuleFactory::createInstance(elementName);
+      if (hadronDecays) {
+        Add(hadronDecays);
+        JSINFO << "JetScape::DetermineTaskList() -- Added HadronDecays to "
+                  "task list.";
+      }
+    }
+
     else {
       VERBOSE(2) << "Nothing to do.";
     }
 
     element = element->NextSiblingElement();
   }
+
+  for (auto &addVariant : addVariants)
+    addVariant();
 }
 
 //________________________________________________________________
@@ -786,39 +924,63 @@ void JetScape::SetModuleId(tinyxml2::XMLElement *moduleElement,
   }
 }
 
+//________________________________________________________________
+std::vector<std::pair<std::string, tinyxml2::XMLElement *>>
+JetScape::ReadVariantsFromXML(const char *section) {
+  std::vector<std::pair<std::string, tinyxml2::XMLElement *>> variants;
+  tinyxml2::XMLElement *element = GetXMLElement({section, "Variants"}, false);
+  for (tinyxml2::XMLElement *variant =
+           element ? element->FirstChildElement("Variant") : nullptr;
+       variant; variant = variant->NextSiblingElement("Variant")) {
+    std::string name =
+        variant->Attribute("name") ? variant->Attribute("name") : "";
+    if (name.empty()) {
+      JSWARN << section << " variant without name is ignored.";
+      continue;
+    }
+    bool known = false;
+    for (auto &v : variants)
+      known = known || v.first == name;
+    if (known) {
+      JSWARN << section << " variant " << name
+             << " given twice, only the first one is used.";
+      continue;
+    }
+    variants.emplace_back(name, variant);
+  }
+  return variants;
+}
+
 //________________________________________________________________
 void JetScape::DetermineWritersFromXML() {
 
   // Get file output name to write to (without file extension, except if custom writer)
   std::string outputFilename = GetXMLElementText({"outputFilename"});
 
-  // Copy string in order to set file extensions for each type
-  std::string outputFilenameAscii = outputFilename;
-  std::string outputFilenameAsciiGZ = outputFilename;
-  std::string outputFilenameHepMC = outputFilename;
-  std::string outputFilenameRootHepMC = outputFilename;
-  std::string outputFilenameFinalStatePartonsAscii = outputFilename;
-  std::string outputFilenameFinalStateHadronsAscii = outputFilename;
-  std::string outputFilenameQnVectorAscii = outputFilename;
-
-
-
-  // Check if each writer is enabled, and if so add it to the task list
-  CheckForWriterFromXML("JetScapeWriterAscii",
-                        outputFilenameAscii.append(".dat"));
-  CheckForWriterFromXML("JetScapeWriterAsciiGZ",
-                        outputFilenameAsciiGZ.append(".dat.gz"));
-  CheckForWriterFromXML("JetScapeWriterHepMC",
-                        outputFilenameHepMC.append(".hepmc"));
-  CheckForWriterFromXML("JetScapeWriterRootHepMC",
-                        outputFilenameRootHepMC.append("_hepmc.root"));
-  CheckForWriterFromXML("JetScapeWriterFinalStatePartonsAscii",
-                        outputFilenameFinalStatePartonsAscii.append("_final_state_partons.dat"));
-  CheckForWriterFromXML("JetScapeWriterFinalStateHadronsAscii",
-                        outputFilenameFinalStateHadronsAscii.append("_final_state_hadrons.dat"));
-  CheckForWriterFromXML("JetScapeWriterQnVectorAscii",
-                        outputFilenameQnVectorAscii.append("_QnVector.dat"));
-    
+  // Check if each writer is enabled, and if so add it to the task list.
+  // Every Eloss and hadronization variant gets its own set of files.
+  std::vector<std::string> variants = {""};
+  variants.insert(variants.end(), hadronization_variants_.begin(),
+                  hadronization_variants_.end());
+  variants.insert(variants.end(), eloss_variants_.begin(),
+                  eloss_variants_.end());
+  for (auto &variant : variants) {
+    std::string base =
+        variant.empty() ? outputFilename : outputFilename + "_" + variant;
+    CheckForWriterFromXML("JetScapeWriterAscii", base + ".dat", variant);
+    CheckForWriterFromXML("JetScapeWriterAsciiGZ", base + ".dat.gz", variant);
+    CheckForWriterFromXML("JetScapeWriterHepMC", base + ".hepmc", variant);
+    CheckForWriterFromXML("JetScapeWriterRootHepMC", base + "_hepmc.root",
+                          variant);
+    CheckForWriterFromXML("JetScapeWriterFinalStatePartonsAscii",
+                          base + "_final_state_partons.dat", variant);
+    CheckForWriterFromXML("JetScapeWriterFinalStateHadronsAscii",
+                          base + "_final_state_hadrons.dat", variant);
+    CheckForWriterFromXML("JetScapeWriterQnVectorAscii",
+                          base + "_QnVector.dat", variant);
+    CheckForWriterFromXML("JetScapeWriterRegression",
+                          base + "_regression.dat", variant);
+  }
 
   // Check for custom writers
   tinyxml2::XMLElement *element =
@@ -838,7 +1000,8 @@ void JetScape::DetermineWritersFromXML() {
 
 //________________________________________________________________
 void JetScape::CheckForWriterFromXML(const char *writerName,
-                                     std::string outputFilename) {
+                                     std::string outputFilename,
+                                     std::string variant) {
 
   std::string enableWriter = GetXMLElementText({writerName});
   VERBOSE(2) << "Parsing writer: " << writerName;
@@ -849,6 +1012,10 @@ void JetScape::CheckForWriterFromXML(const char *writerName,
     if (writer) {
       dynamic_pointer_cast<JetScapeWriter>(writer)->SetOutputFileName(
           outputFilename);
+      dynamic_pointer_cast<JetScapeWriter>(writer)
+          ->GetOutputSelection()
+          .Configure(writerName);
+      dynamic_pointer_cast<JetScapeWriter>(writer)->SetVariant(variant);
       Add(writer);
       JSINFO << "JetScape::DetermineTaskList() -- " << writerName << " ("
              << outputFilename.c_str() << ") added to task list.";
@@ -860,6 +1027,8 @@ void JetScape::CheckForWriterFromXML(const char *writerName,
       VERBOSE(2) << "Manually creating JetScapeWriterHepMC (due to multiple "
                     "inheritance)";
       auto writer = std::make_shared<JetScapeWriterHepMC>(outputFilename);
+      writer->GetOutputSelection().Configure(writerName);
+      writer->SetVariant(variant);
       Add(writer);
       JSINFO << "JetScape::DetermineTaskList() -- " << writerName << " ("
              << outputFilename.c_str() << ") added to task list.";
@@ -871,6 +1040,8 @@ void JetScape::CheckForWriterFromXML(const char *writerName,
       VERBOSE(2) << "Manually creating JetScapeWriterRootHepMC (due to multiple "
                     "inheritance)";
       auto writer = std::make_shared<JetScapeWriterRootHepMC>(outputFilename);
+      writer->GetOutputSelection().Configure(writerName);
+      writer->SetVariant(variant);
       Add(writer);
       JSINFO << "JetScape::DetermineTaskList() -- " << writerName << " ("
              << outputFilename.c_str() << ") added to task list.";
@@ -905,6 +1076,9 @@ void JetScape::SetPointers() {
       JetScapeSignalManager::Instance()->SetHydroPointer(
           dynamic_pointer_cast<FluidDynamics>(it));
       hydro_pointer_is_set = true;
+    } else if (dynamic_pointer_cast<FluidDynamics>(it)) {
+      JetScapeSignalManager::Instance()->SetSourceTermHydroPointer(
+          dynamic_pointer_cast<FluidDynamics>(it));
     } else if (dynamic_pointer_cast<JetEnergyLossManager>(it)) {
       JetScapeSignalManager::Instance()->SetJetEnergyLossManagerPointer(
           dynamic_pointer_cast<JetEnergyLossManager>(it));
@@ -940,6 +1114,198 @@ void JetScape::Exec() {
   JSINFO << BOLDRED << "Run JetScape ...";
   JSINFO << BOLDRED << "Number of Events = " << GetNumberOfEvents();
 
+  if (fork_workers_ > 0) {
+    RunForkServer();
+  } else {
+    RunEvents(0, GetNumberOfEvents());
+  }
+}
+
+//________________________________________________________________
+void JetScape::RunForkServer() {
+  int n_workers = std::min(fork_workers_, std::max(GetNumberOfEvents(), 1));
+  int n_total = GetNumberOfEvents();
+  std::map<pid_t, int> running; // pid -> worker
+  std::vector<int> attempts(n_workers, 0);
+  int n_failed = 0;
+
+  auto launch = [&](int worker) {
+    int first = (int)((long long)n_total * worker / n_workers);
+    int last = (int)((long long)n_total * (worker + 1) / n_workers);
+    // Nothing buffered may be written twice
+    std::cout.flush();
+    std::fflush(nullptr);
+    pid_t pid = fork();
+    if (pid < 0) {
+      JSWARN << "Fork server: fork() failed for worker " << worker;
+      throw std::runtime_error("Fork server could not start a worker.");
+    }
+    if (pid == 0) {
+      RunForkWorker(worker, attempts[worker], first, last); // does not return
+    }
+    running[pid] = worker;
+    JSINFO << BOLDRED << "Fork server: worker " << worker << " (pid " << pid
+           << ") runs events " << first << " to " << last - 1;
+  };
+
+  for (int worker = 0; worker < n_workers; worker++) {
+    launch(worker);
+  }
+
+  while (!running.empty()) {
+    int status = 0;
+    pid_t pid = waitpid(-1, &status, 0);
+    if (pid < 0) {
+      JSWARN << "Fork server: waitpid() failed, " << running.size()
+             << " workers unaccounted for";
+      break;
+    }
+    auto it = running.find(pid);
+    if (it == running.end()) {
+      continue;
+    }
+    int worker = it->second;
+    running.erase(it);
+
+    if (WIFEXITED(status) && WEXITSTATUS(status) == 0) {
+      JSINFO << "Fork server: worker " << worker << " finished";
+      continue;
+    }
+    if (WIFSIGNALED(status)) {
+      JSWARN << "Fork server: worker " << worker << " killed by signal "
+             << WTERMSIG(status);
+    } else {
+      JSWARN << "Fork server: worker " << worker << " exited with status "
+             << WEXITSTATUS(status);
+    }
+    if (attempts[worker] < fork_max_restarts_) {
+      attempts[worker]++;
+      JSWARN << "Fork server: restarting worker " << worker << " (restart "
+             << attempts[worker] << " of " << fork_max_restarts_ << ")";
+      launch(worker);
+    } else {
+      n_failed++;
+    }
+  }
+
+  is_fork_parent_ = true;
+  if (n_failed > 0) {
+    JSWARN << "Fork server: " << n_failed << " of " << n_workers
+           << " workers failed for good, their events are missing";
+  }
+}
+
+#ifdef USE_HEPMC
+// HepMC writers open their file when they are constructed, so writing to
+// another file takes a new writer with the same settings
+template <class T>
+static bool ReplaceHepMCWriter(shared_ptr<JetScapeWriter> &writer,
+                               const std::string &name) {
+  auto old_writer = dynamic_pointer_cast<T>(writer);
+  if (!old_writer)
+    return false;
+  auto new_writer = std::make_shared<T>(name);
+  new_writer->GetOutputSelection() = old_writer->GetOutputSelection();
+  new_writer->SetVariant(old_writer->GetVariant());
+  writer = new_writer;
+  return true;
+}
+#endif
+
+//________________________________________________________________
+void JetScape::RunForkWorker(int worker, int attempt, int first, int last) {
+  int exit_code = 0;
+  try {
+    // Own random streams, also for the Pythia instances seeded during Init
+    unsigned int seed =
+        JetScapeTaskSupport::Instance()->ReseedForWorker(worker, attempt);
+    std::mt19937 seeder(seed);
+    // variants last, so the main run gets the same seeds without them
+    std::vector<shared_ptr<JetScapeTask>> variants;
+    ReseedTasks(GetTaskList(), seeder, &variants);
+    ReseedTasks(variants, seeder);
+
+    // The workers share the CPUs of the parent, each pins to its own slice
+    JetScapeMemoryPlacement::ShareCpus(worker, fork_workers_);
+
+    // Own output files, named after the worker
+    for (auto &writer : fork_writers_) {
+      std::string name = writer->GetOutputFileName();
+      std::string suffix = "_worker" + std::to_string(worker);
+      std::size_t dot = name.find('.', name.find_last_of('/') + 1);
+      name = dot == std::string::npos ? name + suffix : name.insert(dot, suffix);
+      bool replaced = false;
+#ifdef USE_HEPMC
+      replaced = ReplaceHepMCWriter<JetScapeWriterHepMC>(writer, name);
+#ifdef USE_ROOT
+      replaced =
+          replaced || ReplaceHepMCWriter<JetScapeWriterRootHepMC>(writer, name);
+#endif
+#endif
+      if (replaced)
+        Add(writer); // the parent's writer stays inactive
+      writer->SetOutputFileName(name);
+      writer->SetActive(true);
+      writer->Init();
+    }
+
+    SetCurrentEvent(first);
+    RunEvents(first, last);
+    Finish();
+
+    for (auto &writer : fork_writers_) {
+      writer->Close();
+      writer->SetActive(false);
+    }
+  } catch (std::exception &e) {
+    JSWARN << "Fork server: worker " << worker << " failed: " << e.what();
+    exit_code = 1;
+  }
+  // _exit: the parent's atexit handlers and stdio buffers are not ours
+  std::cout.flush();
+  std::fflush(nullptr);
+  _exit(exit_code);
+}
+
+//________________________________________________________________
+static bool IsVariant(const shared_ptr<JetScapeTask> &task) {
+  auto jloss = dynamic_pointer_cast<JetEnergyLoss>(task);
+  if (jloss)
+    return !jloss->GetVariant().empty();
+  auto hadro = dynamic_pointer_cast<Hadronization>(task);
+  return hadro && !hadro->GetVariant().empty();
+}
+
+void JetScape::ReseedTasks(const std::vector<shared_ptr<JetScapeTask>> &tasks,
+                           std::mt19937 &seeder,
+                           std::vector<shared_ptr<JetScapeTask>> *variants) {
+  // Pythia takes seeds up to 900000000, 0 being its fixed default
+  std::uniform_int_distribution<int> pythia_seed(1, 900000000);
+  for (auto &task : tasks) {
+    if (variants && IsVariant(task)) {
+      variants->push_back(task);
+      continue;
+    }
+    auto pythia = dynamic_pointer_cast<Pythia8::Pythia>(task);
+    if (pythia) {
+      int seed = pythia_seed(seeder);
+      pythia->rndm.init(seed);
+      VERBOSE(2) << "Reseeded the Pythia of " << task->GetId() << " to "
+                 << seed;
+    }
+    auto module = dynamic_pointer_cast<JetScapeModuleBase>(task);
+    if (module) {
+      int seed = pythia_seed(seeder);
+      module->ReseedPrivateGenerators(seed);
+    }
+    ReseedTasks(task->GetTaskList(), seeder, variants);
+  }
+}
+
+//________________________________________________________________
+void JetScape::RunEvents(int first, int last) {
+  SetNumberOfEvents(last - first);
+
   // JetScapeTask::ExecuteTasks(); Has to be called explicitly since not really fully recursively (if ever needed)
   // --> JetScape is "Task Manager" of all modules ...
 
@@ -954,13 +1320,20 @@ void JetScape::Exec() {
     }
   }
 
-  for (int i = 0; i < GetNumberOfEvents(); i++) {
+  if (use_run_monitor_) {
+    run_monitor_.Start();
+  }
+
+  for (int i = first; i < last; i++) {
     if (i % n_events_printout == 0) {
       JSINFO << BOLDRED << "Run Event # = " << i;
     }
     VERBOSE(1) << BOLDRED << "Run Event # = " << i;
     JSDEBUG << "Found " << GetNumberOfTasks() << " Modules Execute them ... ";
 
+    // Event-scoped particles and vertices are pooled until the end of the event
+    JetScapeEventMemory::Instance()->BeginEvent();
+
     // First run all tasks
     JetScapeTask::ExecuteTasks();
 
@@ -1025,9 +1398,9 @@ void JetScape::Exec() {
           continue;
         }
 
-        if (i % n_reuse_hydro_ == n_reuse_hydro_ - 1) {
+        if ((i - first) % n_reuse_hydro_ == n_reuse_hydro_ - 1) {
           JSDEBUG << " i was " << i
-                  << " i%n_reuse_hydro_ = " << i % n_reuse_hydro_
+                  << " i%n_reuse_hydro_ = " << (i - first) % n_reuse_hydro_
                   << " --> ACTIVATING";
           it->SetActive(true);
           if (dynamic_pointer_cast<FluidDynamics>(it)) {
@@ -1035,7 +1408,7 @@ void JetScape::Exec() {
           }
         } else {
           JSDEBUG << " i was " << i
-                  << " i%n_reuse_hydro_ = " << i % n_reuse_hydro_
+                  << " i%n_reuse_hydro_ = " << (i - first) % n_reuse_hydro_
                   << " --> DE-ACTIVATING";
           it->SetActive(false);
           if (dynamic_pointer_cast<FluidDynamics>(it)) {
@@ -1045,14 +1418,60 @@ void JetScape::Exec() {
       }
     }
 
+    // Running observables have to be taken before the modules are cleared
+    if (use_run_monitor_) {
+      FillRunMonitor();
+    }
+
     // Now clean up, only affects active taskjs
     JetScapeTask::ClearTasks();
 
+    // Hand the pooled event memory back in one go
+    JetScapeEventMemory::Instance()->EndEvent();
+
     IncrementCurrentEvent();
+
+    // Leave the loop between events, so writers are finalized as usual
+    if (use_run_monitor_) {
+      if (i % n_events_printout == 0) {
+        run_monitor_.PrintStatus();
+      }
+      if (run_monitor_.ShouldStop()) {
+        JSINFO << BOLDRED << "Stopping the run: "
+               << run_monitor_.GetStopReason();
+        run_monitor_.PrintStatus();
+        SetNumberOfEvents(i + 1 - first);
+        break;
+      }
+    }
   }
 }
 
+void JetScape::FillRunMonitor() {
+  double weight = 1.;
+  auto hard = JetScapeSignalManager::Instance()->GetHardProcessPointer().lock();
+  if (hard) {
+    weight = hard->GetEventWeight();
+  }
+
+  vector<shared_ptr<Hadron>> hadrons;
+  auto hadro_manager = JetScapeSignalManager::Instance()
+                           ->GetHadronizationManagerPointer()
+                           .lock();
+  if (hadro_manager) {
+    hadro_manager->GetHadrons(hadrons);
+  }
+  run_monitor_.Fill(hadrons, weight);
+}
+
 void JetScape::Finish() {
+  // The workers have finished their own modules
+  if (is_fork_parent_) {
+    JSINFO << BOLDBLACK << "JetScape fork server finished after "
+           << GetNumberOfEvents() << " events!";
+    return;
+  }
+
   JSINFO << BOLDBLACK << "JetScape finished after " << GetNumberOfEvents()
          << " events!";
   JSDEBUG << "More infos wrap up/saving to file/closing file ...";
@@ -20,6 +20,7 @@
 #include "JetScapeTaskSupport.h"
 #include "JetScapeModuleBase.h"
 #include "CausalLiquefier.h"
+#include "JetScapeRunMonitor.h"
 
 namespace Jetscape {
 
@@ -82,12 +83,31 @@ protected:
   void ReadGeneralParametersFromXML();
   void DetermineTaskListFromXML();
   void DetermineWritersFromXML();
+  /// Named <Variant> children of <section><Variants>, without placeholders
+  std::vector<std::pair<std::string, tinyxml2::XMLElement *>>
+  ReadVariantsFromXML(const char *section);
   void CheckForWriterFromXML(const char *writerName,
-                             std::string outputFilename);
+                             std::string outputFilename,
+                             std::string variant = "");
   void SetModuleId(tinyxml2::XMLElement *moduleElement,
                    shared_ptr<JetScapeModuleBase> module);
 
   void SetPointers();
+  void FillRunMonitor();
+
+  /// Runs events [first, last) in this process
+  void RunEvents(int first, int last);
+
+  /// Fork-server mode: forks the initialized process into workers and
+  /// supervises them until every event range is done
+  void RunForkServer();
+  void RunForkWorker(int worker, int attempt, int first, int last);
+  /// Reseeds Pythia tasks and the private generators of all modules.
+  /// Eloss and hadronization variants are passed over and appended to
+  /// variants if given, so they can be reseeded after the main run.
+  void ReseedTasks(const std::vector<shared_ptr<JetScapeTask>> &tasks,
+                   std::mt19937 &seeder,
+                   std::vector<shared_ptr<JetScapeTask>> *variants = nullptr);
 
   void Show();
   int n_events;
@@ -96,8 +116,21 @@ protected:
   bool reuse_hydro_;
   unsigned int n_reuse_hydro_;
 
+  bool use_run_monitor_;
+  JetScapeRunMonitor run_monitor_;
+
+  int fork_workers_;      ///< 0: fork server off
+  int fork_max_restarts_; ///< per worker
+  bool is_fork_parent_;   ///< set once the parent has handed out all events
+  std::vector<shared_ptr<JetScapeWriter>> fork_writers_; ///< opened per worker
+
   std::shared_ptr<CausalLiquefier> liquefier;
 
+  /// Names of the <JetHadronization><Variants>, in order
+  std::vector<std::string> hadronization_variants_;
+  /// Names of the <Eloss><Variants>, in order
+  std::vector<std::string> eloss_variants_;
+
   bool
       fEnableAutomaticTaskListDetermination; // Option to automatically determine the task list from the XML file,
       // rather than manually calling JetScapeTask::Add() in the run macro.
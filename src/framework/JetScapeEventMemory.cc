@@ -0,0 +1,83 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "JetScapeEventMemory.h"
+#include "JetScapeLogger.h"
+
+namespace Jetscape {
+
+// static member initialization
+thread_local bool JetScapeEventMemory::in_event_ = false;
+
+// ---------------------------------------------------------------------------
+JetScapeEventMemory *JetScapeEventMemory::Instance() {
+  // Magic static, thread safe. Never deleted, since objects may hand their
+  // memory back until the very end of the program.
+  static JetScapeEventMemory *m_pInstance = new JetScapeEventMemory;
+  return m_pInstance;
+}
+
+// ---------------------------------------------------------------------------
+void JetScapeEventMemory::BeginEvent() {
+  std::lock_guard<std::mutex> lock(event_mutex_);
+  open_events_++;
+  in_event_ = true;
+}
+
+// ---------------------------------------------------------------------------
+bool JetScapeEventMemory::EndEvent() {
+  std::lock_guard<std::mutex> lock(event_mutex_);
+  in_event_ = false;
+  if (open_events_ > 0)
+    open_events_--;
+
+  // Other events still allocate from the pool
+  if (open_events_ > 0)
+    return false;
+
+  if (live_allocations_ > 0) {
+#ifndef NDEBUG
+    JSWARN << "JetScapeEventMemory: " << live_allocations_
+           << " event-scoped objects (" << live_bytes_
+           << " bytes) are still referenced after the end of the event, "
+              "keeping the pool.";
+#else
+    VERBOSE(2) << "JetScapeEventMemory: " << live_allocations_
+               << " objects still referenced, keeping the pool.";
+#endif
+    return false;
+  }
+
+  pool_.release();
+  return true;
+}
+
+// ---------------------------------------------------------------------------
+void *JetScapeEventMemory::do_allocate(std::size_t bytes,
+                                       std::size_t alignment) {
+  live_allocations_++;
+  live_bytes_ += bytes;
+  return pool_.allocate(bytes, alignment);
+}
+
+// ---------------------------------------------------------------------------
+void JetScapeEventMemory::do_deallocate(void *p, std::size_t bytes,
+                                        std::size_t alignment) {
+  pool_.deallocate(p, bytes, alignment);
+  live_bytes_ -= bytes;
+  live_allocations_--;
+}
+
+} // end namespace Jetscape
@@ -0,0 +1,95 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+/** Per-event memory resource (meant as singleton) for event-scoped objects
+ * such as Parton, Hadron and Vertex.
+ * Objects created with MakeEventShared<T>(...) live, together with their
+ * shared_ptr control block, in one thread-safe std::pmr pool instead of
+ * individual heap allocations.
+ * JetScape::Exec brackets every event with BeginEvent() / EndEvent().
+ * After the last open event has been cleaned up (JetScapeTask::ClearTasks)
+ * the whole pool is handed back in one step, provided that no object
+ * allocated from it is still alive. Otherwise the pool is kept (never
+ * dangling) and, in debug builds, the leaked allocations are reported.
+ *
+ * Allocations from threads that are not inside an event (initialization,
+ * readers, ...) fall back to plain make_shared.
+ * Threads spawned during an event should call AttachThread() with the
+ * value of InEvent() of their parent.
+ */
+
+#ifndef JETSCAPEEVENTMEMORY_H
+#define JETSCAPEEVENTMEMORY_H
+
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+namespace Jetscape {
+
+class JetScapeEventMemory : public std::pmr::memory_resource {
+
+public:
+  static JetScapeEventMemory *Instance();
+
+  /// Mark the calling thread as working on an event
+  void BeginEvent();
+  /// Release the pool if this was the last open event and nothing
+  /// allocated from it is still referenced.
+  /// @return true if the pool was released
+  bool EndEvent();
+
+  /// Whether the calling thread allocates from the pool
+  static bool InEvent() { return in_event_; }
+  static void AttachThread(bool in_event) { in_event_ = in_event; }
+
+  long GetLiveAllocations() const { return live_allocations_; }
+  long GetLiveBytes() const { return live_bytes_; }
+
+private:
+  JetScapeEventMemory() : live_allocations_(0), live_bytes_(0), open_events_(0){};
+
+  void *do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void *p, std::size_t bytes,
+                     std::size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource &other) const
+      noexcept override {
+    return this == &other;
+  }
+
+  static thread_local bool in_event_;
+
+  std::pmr::synchronized_pool_resource pool_;
+  std::atomic<long> live_allocations_;
+  std::atomic<long> live_bytes_;
+
+  std::mutex event_mutex_;
+  int open_events_;
+};
+
+/// make_shared for event-scoped objects, see JetScapeEventMemory
+template <class T, class... Args>
+std::shared_ptr<T> MakeEventShared(Args &&... args) {
+  if (!JetScapeEventMemory::InEvent())
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  return std::allocate_shared<T>(
+      std::pmr::polymorphic_allocator<T>(JetScapeEventMemory::Instance()),
+      std::forward<Args>(args)...);
+}
+
+} // end namespace Jetscape
+
+#endif
@@ -0,0 +1,169 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "JetScapeMemoryPlacement.h"
+#include "JetScapeXML.h"
+#include "JetScapeLogger.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Jetscape {
+
+bool JetScapeMemoryPlacement::huge_pages_ = false;
+bool JetScapeMemoryPlacement::interleave_ = false;
+bool JetScapeMemoryPlacement::pin_threads_ = false;
+
+namespace {
+
+// Kernel constants from <linux/mempolicy.h>, so that libnuma is not needed
+const int kMpolInterleave = 3;
+const unsigned long kMpolMfMove = 1 << 1;
+const unsigned long kMpolFMemsAllowed = 1 << 2;
+const unsigned long kMaxNodes = 1024;
+const unsigned long kBitsPerWord = 8 * sizeof(unsigned long);
+
+std::vector<unsigned long> allowed_nodes; // node mask, empty if one node
+std::vector<int> allowed_cpus; // empty if the process may not pin
+std::once_flag detected;
+std::atomic<unsigned int> next_pool_base(0);
+
+void FindNodesAndCpus() {
+#ifdef __linux__
+  std::vector<unsigned long> mask(kMaxNodes / kBitsPerWord, 0);
+  int mode = 0;
+  if (syscall(SYS_get_mempolicy, &mode, mask.data(), kMaxNodes, nullptr,
+              kMpolFMemsAllowed) == 0) {
+    int n_nodes = 0;
+    for (auto word : mask)
+      n_nodes += __builtin_popcountl(word);
+    if (n_nodes > 1)
+      allowed_nodes = mask;
+  }
+
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      if (CPU_ISSET(cpu, &cpus))
+        allowed_cpus.push_back(cpu);
+    }
+  }
+#endif
+}
+
+// Detection on first use, so that the setters work without the xml
+void Detect() { std::call_once(detected, FindNodesAndCpus); }
+
+// Optional element that is "on" or a non-zero number
+bool ReadSwitch(std::initializer_list<const char *> path) {
+  auto element = JetScapeXML::Instance()->GetElement(path, false);
+  if (!element || !element->GetText())
+    return false;
+  // whole values only, so that e.g. "none" stays off
+  std::string text = element->GetText();
+  text.erase(0, text.find_first_not_of(" \t\r\n"));
+  text.erase(text.find_last_not_of(" \t\r\n") + 1);
+  return text == "on" || text == "1";
+}
+
+} // namespace
+
+void JetScapeMemoryPlacement::ReadFromXML() {
+  huge_pages_ = ReadSwitch({"MemoryPlacement", "hugePages"});
+  interleave_ = ReadSwitch({"MemoryPlacement", "interleave"});
+  pin_threads_ = ReadSwitch({"MemoryPlacement", "pinThreads"});
+  if (!huge_pages_ && !interleave_ && !pin_threads_)
+    return;
+
+  Detect();
+  JSINFO << "Memory placement: huge pages " << (huge_pages_ ? "on" : "off")
+         << ", interleave " << (interleave_ ? "on" : "off") << " ("
+         << (allowed_nodes.empty() ? "single NUMA node" : "several NUMA nodes")
+         << "), pin threads " << (pin_threads_ ? "on" : "off") << " ("
+         << allowed_cpus.size() << " CPUs)";
+}
+
+void JetScapeMemoryPlacement::Place(const void *p, std::size_t bytes) {
+#ifdef __linux__
+  if ((!huge_pages_ && !interleave_) || !p || bytes < min_bytes)
+    return;
+  Detect();
+
+  // Only whole pages inside the array, its neighbours stay untouched
+  const std::uintptr_t page = sysconf(_SC_PAGESIZE);
+  std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(p);
+  std::uintptr_t end = begin + bytes;
+  begin = (begin + page - 1) / page * page;
+  end = end / page * page;
+  if (end <= begin)
+    return;
+  void *start = reinterpret_cast<void *>(begin);
+  std::size_t length = end - begin;
+
+  if (huge_pages_ && madvise(start, length, MADV_HUGEPAGE) != 0) {
+    VERBOSE(2) << "madvise(MADV_HUGEPAGE) failed for " << length << " bytes";
+  }
+  if (interleave_ && !allowed_nodes.empty() &&
+      syscall(SYS_mbind, start, length, kMpolInterleave, allowed_nodes.data(),
+              kMaxNodes, kMpolMfMove) != 0) {
+    VERBOSE(2) << "mbind(MPOL_INTERLEAVE) failed for " << length << " bytes";
+  }
+#endif
+}
+
+unsigned int JetScapeMemoryPlacement::ReservePool(unsigned int n_threads) {
+  return next_pool_base.fetch_add(n_threads);
+}
+
+void JetScapeMemoryPlacement::ShareCpus(unsigned int share,
+                                        unsigned int n_shares) {
+  Detect();
+  std::size_t n = allowed_cpus.size();
+  std::size_t begin = n * share / n_shares;
+  std::size_t end = n * (share + 1) / n_shares;
+  // too few CPUs for a slice each: pinning would stack processes up
+  if (n < n_shares || end <= begin) {
+    allowed_cpus.clear();
+    return;
+  }
+  allowed_cpus = std::vector<int>(allowed_cpus.begin() + begin,
+                                  allowed_cpus.begin() + end);
+}
+
+void JetScapeMemoryPlacement::PinThread(unsigned int index) {
+#ifdef __linux__
+  if (!pin_threads_)
+    return;
+  Detect();
+  if (allowed_cpus.empty())
+    return;
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(allowed_cpus[index % allowed_cpus.size()], &cpus);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+#endif
+}
+
+} // end namespace Jetscape
@@ -0,0 +1,85 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+/** Placement of large read-mostly arrays (hydro history, rate tables) on
+ * multi-socket nodes, configured by <MemoryPlacement> in the xml.
+ *
+ * Place() asks the kernel to back an array with transparent huge pages and
+ * to interleave its pages over all NUMA nodes the process may use, so that
+ * threads on every socket see the same average latency instead of all
+ * reading from the node that touched the array first. Pages that already
+ * exist are migrated, so Place() also works on filled arrays; calling it
+ * before the first write avoids the migration.
+ *
+ * PinThread() binds worker threads round-robin to the CPUs of the process,
+ * which keeps them from wandering between sockets. Each thread pool reserves
+ * its own range of indices, so that pools start on different CPUs, and
+ * processes that share the CPUs (fork-server workers) each take a slice.
+ *
+ * Everything is a no-op when switched off and on systems without these
+ * facilities (anything but Linux), and failures only cost performance.
+ */
+
+#ifndef JETSCAPEMEMORYPLACEMENT_H
+#define JETSCAPEMEMORYPLACEMENT_H
+
+#include <cstddef>
+#include <vector>
+
+namespace Jetscape {
+
+class JetScapeMemoryPlacement {
+
+public:
+  /// Reads <MemoryPlacement>; needs the xml files opened
+  static void ReadFromXML();
+
+  static void SetHugePages(bool on) { huge_pages_ = on; }
+  static void SetInterleave(bool on) { interleave_ = on; }
+  static void SetPinThreads(bool on) { pin_threads_ = on; }
+  static bool GetHugePages() { return huge_pages_; }
+  static bool GetInterleave() { return interleave_; }
+  static bool GetPinThreads() { return pin_threads_; }
+
+  /// Applies the placement to the whole pages inside [p, p + bytes).
+  /// Arrays smaller than min_bytes are left alone.
+  static void Place(const void *p, std::size_t bytes);
+
+  template <class T> static void Place(const std::vector<T> &v) {
+    Place(v.data(), v.size() * sizeof(T));
+  }
+
+  /// First index of a new pool of n_threads threads, to be added to the
+  /// thread index given to PinThread()
+  static unsigned int ReservePool(unsigned int n_threads);
+
+  /// Restricts pinning to slice share of n_shares of the CPUs of the process;
+  /// pinning is skipped if there are fewer CPUs than shares
+  static void ShareCpus(unsigned int share, unsigned int n_shares);
+
+  /// Binds the calling thread to CPU (index mod #CPUs of the process)
+  static void PinThread(unsigned int index);
+
+  static const std::size_t min_bytes = 1 << 21;
+
+private:
+  static bool huge_pages_;
+  static bool interleave_;
+  static bool pin_threads_;
+};
+
+} // end namespace Jetscape
+
+#endif // JETSCAPEMEMORYPLACEMENT_H
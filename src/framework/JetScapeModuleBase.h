@@ -83,10 +83,28 @@ public:
    */
   static void IncrementCurrentEvent() { current_event++; }
 
+  /** This function sets the current event number, e.g. to the first event
+      of a fork-server worker's range.
+   */
+  static void SetCurrentEvent(int event) { current_event = event; }
+
   /** This function returns a random number based on Mersenne-Twister algorithm.
    */
   shared_ptr<std::mt19937> GetMt19937Generator();
 
+  /** Hands the module an engine of its own instead of the one of its task
+      number, e.g. the engine of an Eloss or hadronization variant.
+   */
+  void SetMt19937Generator(shared_ptr<std::mt19937> generator) {
+    mt19937_generator_ = generator;
+  }
+
+  /** Reseeds the random generators a module keeps besides GetMt19937Generator(),
+      e.g. its own Pythia. Called with a fresh seed in every fork-server worker,
+      so that the workers do not repeat each other's random streams.
+   */
+  virtual void ReseedPrivateGenerators(unsigned int seed){};
+
   /** Helper functions for XML parsing, wrapping functionality in JetScapeXML:
    */
   tinyxml2::XMLElement *GetXMLElement(std::initializer_list<const char *> path,
@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "JetScapeOutputSelection.h"
+#include "JetScapeXML.h"
+#include "JetScapeLogger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace Jetscape {
+
+namespace {
+
+// Text of an optional element, "" if it is missing or empty
+std::string OptionalText(std::initializer_list<const char *> path) {
+  auto element = JetScapeXML::Instance()->GetElement(path, false);
+  if (!element || !element->GetText())
+    return "";
+  return element->GetText();
+}
+
+std::vector<int> ReadInts(const std::string &text) {
+  std::vector<int> values;
+  std::istringstream is(text);
+  int v;
+  while (is >> v)
+    values.push_back(v);
+  return values;
+}
+
+std::vector<int> Sorted(std::vector<int> v) {
+  std::sort(v.begin(), v.end());
+  return v;
+}
+
+bool Contains(const std::vector<int> &sorted, int v) {
+  return std::binary_search(sorted.begin(), sorted.end(), v);
+}
+
+} // namespace
+
+JetScapeOutputSelection::JetScapeOutputSelection()
+    : active_(false), charge_(AllCharges), pt_min_sqr_(0.), pt_max_sqr_(-1.),
+      eta_max_(-1.), tanh_sqr_eta_max_(1.), holes_(Keep), recoils_(Keep) {}
+
+JetScapeOutputSelection::Treatment
+JetScapeOutputSelection::ReadTreatment(const std::string &text) {
+  if (text.find("drop") != std::string::npos)
+    return Drop;
+  if (text.find("only") != std::string::npos)
+    return Only;
+  return Keep;
+}
+
+void JetScapeOutputSelection::Configure(const std::string &writer_name) {
+  active_ = false;
+  if (JetScapeXML::Instance()->GetElementInt({"OutputSelection", "active"},
+                                             false) == 0)
+    return;
+
+  std::istringstream writers(OptionalText({"OutputSelection", "writers"}));
+  std::string w;
+  bool listed = false;
+  while (writers >> w) {
+    listed = listed || w == writer_name ||
+             (w == "all" && writer_name != "JetScapeWriterRegression");
+  }
+  if (!listed)
+    return;
+
+  active_ = true;
+  SetPids(ReadInts(OptionalText({"OutputSelection", "pids"})));
+  SetExcludedPids(ReadInts(OptionalText({"OutputSelection", "exclude_pids"})));
+  SetStatuses(ReadInts(OptionalText({"OutputSelection", "status"})));
+
+  std::string charge = OptionalText({"OutputSelection", "charge"});
+  charge_ = charge.find("neutral") != std::string::npos   ? Neutral
+            : charge.find("charged") != std::string::npos ? Charged
+                                                          : AllCharges;
+
+  double pt_min = 0., pt_max = -1.;
+  if (!OptionalText({"OutputSelection", "pt_min"}).empty())
+    pt_min = JetScapeXML::Instance()->GetElementDouble(
+        {"OutputSelection", "pt_min"});
+  if (!OptionalText({"OutputSelection", "pt_max"}).empty())
+    pt_max = JetScapeXML::Instance()->GetElementDouble(
+        {"OutputSelection", "pt_max"});
+  SetPtRange(pt_min, pt_max);
+  double eta_max = -1.;
+  if (!OptionalText({"OutputSelection", "eta_max"}).empty())
+    eta_max = JetScapeXML::Instance()->GetElementDouble(
+        {"OutputSelection", "eta_max"});
+  SetEtaMax(eta_max);
+
+  holes_ = ReadTreatment(OptionalText({"OutputSelection", "holes"}));
+  recoils_ = ReadTreatment(OptionalText({"OutputSelection", "recoils"}));
+
+  JSINFO << "Output selection for " << writer_name << ": " << Describe();
+}
+
+void JetScapeOutputSelection::SetPids(const std::vector<int> &pids) {
+  pids_ = Sorted(pids);
+}
+
+void JetScapeOutputSelection::SetExcludedPids(const std::vector<int> &pids) {
+  excluded_pids_ = Sorted(pids);
+}
+
+void JetScapeOutputSelection::SetStatuses(const std::vector<int> &statuses) {
+  statuses_ = Sorted(statuses);
+}
+
+void JetScapeOutputSelection::SetPtRange(double pt_min, double pt_max) {
+  pt_min_sqr_ = pt_min > 0. ? pt_min * pt_min : 0.;
+  pt_max_sqr_ = pt_max >= 0. ? pt_max * pt_max : -1.;
+}
+
+void JetScapeOutputSelection::SetEtaMax(double eta_max) {
+  eta_max_ = eta_max;
+  double t = std::tanh(eta_max);
+  tanh_sqr_eta_max_ = t * t;
+}
+
+int JetScapeOutputSelection::ChargeType(int pid) const {
+  auto it = charge_types_.find(pid);
+  if (it != charge_types_.end())
+    return it->second;
+  int c = JetScapeParticleBase::InternalHelperPythia.particleData.chargeType(pid);
+  charge_types_.emplace(pid, c);
+  return c;
+}
+
+bool JetScapeOutputSelection::Passes(const JetScapeParticleBase &p) const {
+  // Cheap integer cuts first
+  int stat = p.pstat();
+  if (holes_ != Keep && (stat < 0) != (holes_ == Only))
+    return false;
+  if (recoils_ != Keep && (stat == 1) != (recoils_ == Only))
+    return false;
+  if (!statuses_.empty() && !Contains(statuses_, stat))
+    return false;
+
+  int pid = p.pid();
+  if (!pids_.empty() && !Contains(pids_, pid))
+    return false;
+  if (!excluded_pids_.empty() && Contains(excluded_pids_, pid))
+    return false;
+  if (charge_ != AllCharges && (ChargeType(pid) != 0) != (charge_ == Charged))
+    return false;
+
+  // Kinematics without square roots or logarithms
+  double pt2 = p.pt2();
+  if (pt2 < pt_min_sqr_ || (pt_max_sqr_ >= 0. && pt2 > pt_max_sqr_))
+    return false;
+  if (eta_max_ >= 0.) {
+    // |eta| < eta_max  <=>  pz^2 (1 - tanh^2) < tanh^2 pt^2
+    double pz = p.pz();
+    if (pz * pz * (1. - tanh_sqr_eta_max_) >= tanh_sqr_eta_max_ * pt2)
+      return false;
+  }
+  return true;
+}
+
+std::string JetScapeOutputSelection::Describe() const {
+  if (!active_)
+    return "all particles";
+  std::ostringstream os;
+  auto list = [&os](const char *name, const std::vector<int> &v) {
+    os << name;
+    for (auto i : v)
+      os << " " << i;
+    os << "; ";
+  };
+  if (!pids_.empty())
+    list("pids", pids_);
+  if (!excluded_pids_.empty())
+    list("excluded pids", excluded_pids_);
+  if (!statuses_.empty())
+    list("status", statuses_);
+  if (charge_ != AllCharges)
+    os << (charge_ == Charged ? "charged" : "neutral") << "; ";
+  os << "pt > " << std::sqrt(pt_min_sqr_);
+  if (pt_max_sqr_ >= 0.)
+    os << " and < " << std::sqrt(pt_max_sqr_);
+  os << "; ";
+  if (eta_max_ >= 0.)
+    os << "|eta| < " << eta_max_ << "; ";
+  const char *names[] = {"keep", "drop", "only"};
+  os << "holes: " << names[holes_] << "; recoils: " << names[recoils_];
+  return os.str();
+}
+
+} // end namespace Jetscape
@@ -0,0 +1,112 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+// Particle-level selection of what the writers put out
+
+#ifndef JETSCAPEOUTPUTSELECTION_H
+#define JETSCAPEOUTPUTSELECTION_H
+
+#include "JetScapeParticles.h"
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Jetscape {
+
+/** Cuts on single final-state particles (hadrons, and final partons where a
+    writer writes them as a list), applied by the writers before formatting.
+    The cuts are read once from the <OutputSelection> block of the xml and
+    kept in a flat form, so Accept() only compares numbers. A selection that
+    was never configured accepts everything.
+
+    Status handling: holes are particles with negative status, recoils
+    partons with status 1 (and hadrons made from them, if a module keeps
+    that status). Each can be kept, dropped or selected exclusively.
+    Shower graphs are written whole; use the StreamFilter writers to drop
+    them altogether.
+ */
+class JetScapeOutputSelection {
+
+public:
+  enum Treatment { Keep = 0, Drop = 1, Only = 2 };
+  enum ChargeSelection { AllCharges = 0, Charged = 1, Neutral = 2 };
+
+  JetScapeOutputSelection();
+
+  /// Reads <OutputSelection> for the writer registered as writer_name. The
+  /// selection stays inactive if the block is off or the writer is not in
+  /// its <writers> list. "all" covers every writer except the regression
+  /// writer, which has to be listed by name.
+  void Configure(const std::string &writer_name);
+
+  bool IsActive() const { return active_; }
+  void SetActive(bool active) { active_ = active; }
+
+  void SetPids(const std::vector<int> &pids);
+  void SetExcludedPids(const std::vector<int> &pids);
+  void SetStatuses(const std::vector<int> &statuses);
+  void SetCharge(ChargeSelection charge) { charge_ = charge; }
+  void SetPtRange(double pt_min, double pt_max);
+  void SetEtaMax(double eta_max);
+  void SetHoles(Treatment holes) { holes_ = holes; }
+  void SetRecoils(Treatment recoils) { recoils_ = recoils; }
+
+  /// Whether the particle passes all cuts (always true if inactive)
+  bool Accept(const JetScapeParticleBase &p) const {
+    return !active_ || Passes(p);
+  }
+
+  /// Removes the rejected particles from a list, keeping the order
+  template <class P> void Select(std::vector<std::shared_ptr<P>> &list) const {
+    if (!active_)
+      return;
+    unsigned int n = 0;
+    for (auto &p : list) {
+      if (Passes(*p))
+        list[n++] = p;
+    }
+    list.resize(n);
+  }
+
+  /// One line per cut, for the log
+  std::string Describe() const;
+
+private:
+  bool Passes(const JetScapeParticleBase &p) const;
+  int ChargeType(int pid) const;
+
+  static Treatment ReadTreatment(const std::string &text);
+
+  bool active_;
+
+  std::vector<int> pids_;          ///< sorted, empty = all
+  std::vector<int> excluded_pids_; ///< sorted
+  std::vector<int> statuses_;      ///< sorted, empty = all
+  ChargeSelection charge_;
+  double pt_min_sqr_, pt_max_sqr_; ///< pt_max_sqr_ < 0: no upper cut
+  double eta_max_;                 ///< < 0: no cut
+  double tanh_sqr_eta_max_;        ///< tanh^2(eta_max_), for Passes()
+  Treatment holes_;
+  Treatment recoils_;
+
+  /// 3 * charge of the species seen so far
+  mutable std::unordered_map<int, int> charge_types_;
+};
+
+} // end namespace Jetscape
+
+#endif // JETSCAPEOUTPUTSELECTION_H
@@ -23,12 +23,14 @@
 #include "JetScapeLogger.h"
 #include "JetScapeParticles.h"
 #include "JetScapeConstants.h"
+#include "JetScapePythiaStore.h"
 
 namespace Jetscape {
 
 // Initialize static MakeUniqueHelper.here
-Pythia8::Pythia JetScapeParticleBase::InternalHelperPythia("IntentionallyEmpty",
-                                                           false);
+Pythia8::Pythia JetScapeParticleBase::InternalHelperPythia(
+    JetScapePythiaStore::Settings(), JetScapePythiaStore::ParticleData(),
+    false);
 
 JetScapeParticleBase::~JetScapeParticleBase() { VERBOSESHOWER(9); }
 
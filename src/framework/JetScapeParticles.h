@@ -63,6 +63,7 @@
 #include "FourVector.h"
 #include "fjcore.hh"
 #include "JetScapeLogger.h"
+#include "JetScapeEventMemory.h"
 #include "PartonShower.h"
 
 #include "Pythia8/Pythia.h"
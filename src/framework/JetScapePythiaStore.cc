@@ -0,0 +1,30 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+#include "JetScapePythiaStore.h"
+
+namespace Jetscape {
+
+Pythia8::Pythia &JetScapePythiaStore::Database() {
+  // Magic static, so that static Pythia objects of other translation units
+  // can be copied from it during static initialization.
+  // PYTHIA8DATA takes precedence over the (intentionally invalid) xml path.
+  static Pythia8::Pythia *database =
+      new Pythia8::Pythia("IntentionallyEmpty", false);
+  return *database;
+}
+
+} // end namespace Jetscape
@@ -0,0 +1,49 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+
+/** Pythia databases read once per process (meant as singleton).
+ *
+ * Constructing a Pythia object parses all xml files of the Pythia data
+ * directory (PYTHIA8DATA) to fill its Settings and ParticleData, which is a
+ * large fixed cost when several modules, threads or variations each need
+ * their own instance. Here the files are parsed once; every further Pythia
+ * is a copy of these databases in memory, and code that only looks up
+ * particle properties reads ParticleData() directly.
+ */
+
+#ifndef JETSCAPEPYTHIASTORE_H
+#define JETSCAPEPYTHIASTORE_H
+
+#include "Pythia8/Pythia.h"
+
+namespace Jetscape {
+
+class JetScapePythiaStore {
+
+public:
+  /// Databases as read from the xml files, never modified afterwards
+  static Pythia8::Settings &Settings() { return Database().settings; }
+  static Pythia8::ParticleData &ParticleData() {
+    return Database().particleData;
+  }
+
+private:
+  static Pythia8::Pythia &Database();
+};
+
+} // end namespace Jetscape
+
+#endif // JETSCAPEPYTHIASTORE_H
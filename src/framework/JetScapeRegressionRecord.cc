@@ -0,0 +1,331 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "JetScapeRegressionRecord.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace Jetscape {
+
+namespace {
+
+// Number of leading integer fields per record type
+int NumberOfInts(char type) {
+  switch (type) {
+  case 'E':
+    return 1;
+  case 'P':
+    return 7;
+  case 'V':
+    return 1;
+  case 'H':
+    return 3;
+  default:
+    return -1;
+  }
+}
+
+bool SameBits(double a, double b) { return std::memcmp(&a, &b, sizeof(a)) == 0; }
+
+// Strict weak ordering on the exact content, used to sort unordered sections
+bool RecordLess(const RegressionRecord &a, const RegressionRecord &b) {
+  if (a.type != b.type)
+    return a.type < b.type;
+  if (a.ints != b.ints)
+    return a.ints < b.ints;
+  for (unsigned int i = 0; i < a.reals.size() && i < b.reals.size(); i++) {
+    if (!SameBits(a.reals[i], b.reals[i]))
+      return a.reals[i] < b.reals[i];
+  }
+  return a.reals.size() < b.reals.size();
+}
+
+bool SectionLess(const RegressionSection &a, const RegressionSection &b) {
+  return std::lexicographical_compare(a.records.begin(), a.records.end(),
+                                      b.records.begin(), b.records.end(),
+                                      RecordLess);
+}
+
+std::string Describe(const RegressionRecord &r) {
+  std::ostringstream os;
+  os << r.type;
+  for (auto i : r.ints)
+    os << " " << i;
+  os.precision(17);
+  for (auto x : r.reals)
+    os << " " << x;
+  return os.str();
+}
+
+} // namespace
+
+bool ReadRegressionFile(const std::string &file_name,
+                        std::vector<RegressionEvent> &events,
+                        std::string &error) {
+  events.clear();
+  std::ifstream in(file_name.c_str());
+  if (!in.is_open()) {
+    error = "cannot open " + file_name;
+    return false;
+  }
+
+  std::string line;
+  int line_number = 0;
+  bool tag_found = false;
+  while (std::getline(in, line)) {
+    line_number++;
+    std::istringstream is(line);
+    std::vector<std::string> tokens;
+    std::string token;
+    while (is >> token)
+      tokens.push_back(token);
+    if (tokens.empty())
+      continue;
+
+    std::ostringstream where;
+    where << file_name << ":" << line_number << ": ";
+
+    if (tokens[0] == "#") {
+      if (tokens.size() > 2 && tokens[1] == RegressionFileTag) {
+        if (tokens[2] != "v" + std::to_string(RegressionFileVersion)) {
+          error = where.str() + "unsupported version " + tokens[2];
+          return false;
+        }
+        tag_found = true;
+      }
+      continue;
+    }
+    if (!tag_found) {
+      error = where.str() + "not a regression file";
+      return false;
+    }
+
+    char type = tokens[0][0];
+    if (type == 'M') {
+      if (events.empty() || tokens.size() < 2) {
+        error = where.str() + "module section outside of an event";
+        return false;
+      }
+      RegressionSection section;
+      section.module = tokens[1] + ":" + (tokens.size() > 2 ? tokens[2] : "");
+      events.back().sections.push_back(section);
+      continue;
+    }
+
+    int n_ints = NumberOfInts(type);
+    if (n_ints < 0 || (int)tokens.size() < n_ints + 1) {
+      error = where.str() + "malformed record";
+      return false;
+    }
+    RegressionRecord record;
+    record.type = type;
+    for (unsigned int i = 1; i < tokens.size(); i++) {
+      char *end = nullptr;
+      if ((int)i <= n_ints) {
+        record.ints.push_back(std::strtol(tokens[i].c_str(), &end, 10));
+      } else {
+        record.reals.push_back(std::strtod(tokens[i].c_str(), &end));
+      }
+      if (!end || *end != '\0') {
+        error = where.str() + "cannot parse '" + tokens[i] + "'";
+        return false;
+      }
+    }
+
+    if (type == 'E') {
+      RegressionEvent event;
+      event.number = record.ints[0];
+      event.header = record.reals;
+      events.push_back(event);
+    } else if (events.empty()) {
+      error = where.str() + "record outside of an event";
+      return false;
+    } else {
+      if (events.back().sections.empty())
+        events.back().sections.push_back(RegressionSection{"Event:", {}});
+      events.back().sections.back().records.push_back(record);
+    }
+  }
+
+  if (!tag_found) {
+    error = file_name + ": not a regression file";
+    return false;
+  }
+  return true;
+}
+
+JetScapeRegressionComparison::JetScapeRegressionComparison()
+    : default_tolerance_(0.), unordered_(false), max_reports_(10),
+      n_differing_events_(0) {}
+
+double
+JetScapeRegressionComparison::GetTolerance(const std::string &module) const {
+  auto it = tolerances_.find(module);
+  if (it != tolerances_.end())
+    return it->second;
+
+  auto colon = module.find(':');
+  if (colon != std::string::npos) {
+    it = tolerances_.find(module.substr(colon + 1));
+    if (it != tolerances_.end())
+      return it->second;
+    it = tolerances_.find(module.substr(0, colon));
+    if (it != tolerances_.end())
+      return it->second;
+  }
+  return default_tolerance_;
+}
+
+bool JetScapeRegressionComparison::RealsMatch(double a, double b,
+                                              double tol) const {
+  if (SameBits(a, b))
+    return true;
+  if (tol <= 0.)
+    return false;
+  if (std::isnan(a) || std::isnan(b))
+    return std::isnan(a) && std::isnan(b);
+  double scale = std::max({std::abs(a), std::abs(b), 1.});
+  return std::abs(a - b) <= tol * scale;
+}
+
+void JetScapeRegressionComparison::SortSections(RegressionEvent &event) const {
+  // Keep the kinds in pipeline order, sort within a module
+  std::map<std::string, int> rank;
+  for (const auto &s : event.sections)
+    rank.emplace(s.module, rank.size());
+  std::stable_sort(event.sections.begin(), event.sections.end(),
+                   [&rank](const RegressionSection &a,
+                           const RegressionSection &b) {
+                     if (a.module != b.module)
+                       return rank[a.module] < rank[b.module];
+                     return SectionLess(a, b);
+                   });
+}
+
+bool JetScapeRegressionComparison::CompareSection(
+    const RegressionSection &ref, const RegressionSection &cand,
+    std::string &what) const {
+  double tol = GetTolerance(ref.module);
+  unsigned int n = std::min(ref.records.size(), cand.records.size());
+  for (unsigned int i = 0; i < n; i++) {
+    const auto &a = ref.records[i];
+    const auto &b = cand.records[i];
+    bool match = a.type == b.type && a.ints == b.ints &&
+                 a.reals.size() == b.reals.size();
+    for (unsigned int k = 0; match && k < a.reals.size(); k++) {
+      match = RealsMatch(a.reals[k], b.reals[k], tol);
+    }
+    if (!match) {
+      std::ostringstream os;
+      os << "record " << i << " differs:\n    reference: " << Describe(a)
+         << "\n    candidate: " << Describe(b);
+      what = os.str();
+      return false;
+    }
+  }
+  if (ref.records.size() != cand.records.size()) {
+    std::ostringstream os;
+    os << "number of records " << ref.records.size() << " != "
+       << cand.records.size();
+    what = os.str();
+    return false;
+  }
+  return true;
+}
+
+bool JetScapeRegressionComparison::CompareEvent(const RegressionEvent &ref,
+                                                const RegressionEvent &cand,
+                                                std::string &module,
+                                                std::string &what) const {
+  unsigned int n = std::min(ref.sections.size(), cand.sections.size());
+  for (unsigned int i = 0; i < n; i++) {
+    const auto &a = ref.sections[i];
+    const auto &b = cand.sections[i];
+    module = a.module;
+    if (a.module != b.module) {
+      what = "section " + std::to_string(i) + " is " + b.module +
+             " instead of " + a.module;
+      return false;
+    }
+    if (!CompareSection(a, b, what)) {
+      what = "section " + std::to_string(i) + ", " + what;
+      return false;
+    }
+  }
+  if (ref.sections.size() != cand.sections.size()) {
+    const auto &longer =
+        ref.sections.size() > n ? ref.sections : cand.sections;
+    module = longer[n].module;
+    what = "number of module sections " + std::to_string(ref.sections.size()) +
+           " != " + std::to_string(cand.sections.size());
+    return false;
+  }
+
+  // Event weight and pt-hat belong to the hard process
+  double tol = GetTolerance("Hard:");
+  bool header_match = ref.header.size() == cand.header.size();
+  for (unsigned int k = 0; header_match && k < ref.header.size(); k++) {
+    header_match = RealsMatch(ref.header[k], cand.header[k], tol);
+  }
+  if (!header_match) {
+    module = "Event:header";
+    what = "event weight or pt-hat differs";
+    return false;
+  }
+  return true;
+}
+
+bool JetScapeRegressionComparison::Compare(
+    const std::vector<RegressionEvent> &reference,
+    const std::vector<RegressionEvent> &candidate) {
+  report_.clear();
+  first_differences_.clear();
+  n_differing_events_ = 0;
+
+  if (reference.size() != candidate.size()) {
+    report_.push_back("Number of events " + std::to_string(reference.size()) +
+                      " != " + std::to_string(candidate.size()));
+  }
+
+  unsigned int n = std::min(reference.size(), candidate.size());
+  for (unsigned int i = 0; i < n; i++) {
+    RegressionEvent ref = reference[i];
+    RegressionEvent cand = candidate[i];
+    if (unordered_) {
+      SortSections(ref);
+      SortSections(cand);
+    }
+
+    std::string module, what;
+    if (CompareEvent(ref, cand, module, what))
+      continue;
+
+    n_differing_events_++;
+    first_differences_[module]++;
+    if ((int)report_.size() < max_reports_) {
+      report_.push_back("Event " + std::to_string(ref.number) +
+                        ": first difference in " + module + ", " + what);
+    }
+  }
+
+  return n_differing_events_ == 0 && reference.size() == candidate.size();
+}
+
+} // end namespace Jetscape
@@ -0,0 +1,124 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+/** Reading and comparing the event records of JetScapeWriterRegression.
+ *
+ * File format, one record per line, tab separated, reals in hexfloat:
+ *   #  JETSCAPE_REGRESSION  v1
+ *   E  event  weight pt_hat
+ *   M  kind id                      (starts a module section)
+ *   P  src tgt label pid stat col acol  px py pz e  x y z t  virtuality
+ *   V  node  x y z t
+ *   H  label pid stat  px py pz e  x y z t
+ * Hard partons and shower initiating partons have src = tgt = -1.
+ * A shower is written as a section "Shower <energy loss id>" with the
+ * initiating parton and the vertices, followed by one section
+ * "Eloss <module>" per energy loss module (Matter, Lbt, ...) holding the
+ * partons that module produced.
+ *
+ * A comparison walks through the events in order. Integer fields have to
+ * agree exactly; reals either bit by bit (tolerance 0) or within a relative
+ * tolerance, |a - b| <= tol * max(|a|, |b|, 1), which can be set per module.
+ * A difference is attributed to the first module section of the event that
+ * differs, since everything downstream of it will usually differ as well.
+ */
+
+#ifndef JETSCAPEREGRESSIONRECORD_H
+#define JETSCAPEREGRESSIONRECORD_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Jetscape {
+
+constexpr const char RegressionFileTag[] = "JETSCAPE_REGRESSION";
+constexpr int RegressionFileVersion = 1;
+
+struct RegressionRecord {
+  char type;
+  std::vector<long> ints;
+  std::vector<double> reals;
+};
+
+struct RegressionSection {
+  std::string module; ///< "<kind>:<id>", e.g. "Eloss:Matter"
+  std::vector<RegressionRecord> records;
+};
+
+struct RegressionEvent {
+  long number = -1;
+  std::vector<double> header; ///< weight, pt_hat
+  std::vector<RegressionSection> sections;
+};
+
+/// Read a regression file. Returns false and fills error on failure.
+bool ReadRegressionFile(const std::string &file_name,
+                        std::vector<RegressionEvent> &events,
+                        std::string &error);
+
+class JetScapeRegressionComparison {
+
+public:
+  JetScapeRegressionComparison();
+
+  /// Tolerance used for modules without their own. 0 means bitwise.
+  void SetDefaultTolerance(double rel) { default_tolerance_ = rel; }
+  /// module may be the full section name ("Eloss:Matter"), the module id
+  /// ("Matter") or the kind ("Eloss"), looked up in that order.
+  void SetTolerance(const std::string &module, double rel) {
+    tolerances_[module] = rel;
+  }
+  double GetTolerance(const std::string &module) const;
+
+  /// Compare the sections of a kind regardless of their order, e.g. for
+  /// showers that ran in separate threads.
+  void SetUnordered(bool unordered) { unordered_ = unordered; }
+
+  /// Number of individual differences to describe in the report.
+  void SetMaxReports(int n) { max_reports_ = n; }
+
+  /// Returns true if the candidate matches the reference.
+  bool Compare(const std::vector<RegressionEvent> &reference,
+               const std::vector<RegressionEvent> &candidate);
+
+  const std::vector<std::string> &GetReport() const { return report_; }
+  /// Number of events in which a module was the first one to differ
+  const std::map<std::string, int> &GetFirstDifferences() const {
+    return first_differences_;
+  }
+  int GetNumberOfDifferingEvents() const { return n_differing_events_; }
+
+private:
+  bool CompareEvent(const RegressionEvent &ref, const RegressionEvent &cand,
+                    std::string &module, std::string &what) const;
+  bool CompareSection(const RegressionSection &ref,
+                      const RegressionSection &cand, std::string &what) const;
+  bool RealsMatch(double a, double b, double tol) const;
+  void SortSections(RegressionEvent &event) const;
+
+  double default_tolerance_;
+  std::map<std::string, double> tolerances_;
+  bool unordered_;
+  int max_reports_;
+
+  std::vector<std::string> report_;
+  std::map<std::string, int> first_differences_;
+  int n_differing_events_;
+};
+
+} // end namespace Jetscape
+
+#endif // JETSCAPEREGRESSIONRECORD_H
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "JetScapeRunMonitor.h"
+#include "JetScapeLogger.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+namespace Jetscape {
+
+JetScapeRunMonitor::JetScapeRunMonitor()
+    : target_rel_error_(0.), eta_max_(1.), n_min_events_(0),
+      max_wall_time_(0.), n_events_(0),
+      start_(std::chrono::steady_clock::now()) {}
+
+void JetScapeRunMonitor::SetPtBinEdges(const std::vector<double> &edges) {
+  pt_edges_ = edges;
+  std::sort(pt_edges_.begin(), pt_edges_.end());
+  unsigned int n_bins = pt_edges_.size() > 1 ? pt_edges_.size() - 1 : 0;
+  sum_y_.assign(n_bins, 0.);
+  sum_y2_.assign(n_bins, 0.);
+  event_y_.assign(n_bins, 0.);
+  n_events_ = 0;
+}
+
+void JetScapeRunMonitor::Start() {
+  start_ = std::chrono::steady_clock::now();
+  stop_reason_.clear();
+}
+
+void JetScapeRunMonitor::Fill(
+    const std::vector<std::shared_ptr<Hadron>> &hadrons,
+    double event_weight) {
+  n_events_++;
+  if (sum_y_.empty())
+    return;
+
+  std::fill(event_y_.begin(), event_y_.end(), 0.);
+  for (const auto &h : hadrons) {
+    if (!h || std::abs(h->eta()) >= eta_max_)
+      continue;
+    double pt = h->pt();
+    auto it = std::upper_bound(pt_edges_.begin(), pt_edges_.end(), pt);
+    if (it == pt_edges_.begin() || it == pt_edges_.end())
+      continue;
+    unsigned int bin = it - pt_edges_.begin() - 1;
+    event_y_[bin] += h->pstat() < 0 ? -1. : 1.;
+  }
+
+  for (unsigned int b = 0; b < event_y_.size(); b++) {
+    double y = event_weight * event_y_[b];
+    sum_y_[b] += y;
+    sum_y2_[b] += y * y;
+  }
+}
+
+double JetScapeRunMonitor::GetRelativeError(unsigned int bin) const {
+  double s1 = sum_y_.at(bin);
+  if (n_events_ < 2 || s1 == 0.)
+    return std::numeric_limits<double>::infinity();
+  double var = sum_y2_[bin] - s1 * s1 / n_events_;
+  return std::sqrt(std::max(var, 0.)) / std::abs(s1);
+}
+
+double JetScapeRunMonitor::GetMaxRelativeError() const {
+  if (sum_y_.empty())
+    return std::numeric_limits<double>::infinity();
+  double max_err = 0.;
+  for (unsigned int b = 0; b < sum_y_.size(); b++) {
+    max_err = std::max(max_err, GetRelativeError(b));
+  }
+  return max_err;
+}
+
+double JetScapeRunMonitor::GetElapsedSeconds() const {
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                       start_)
+      .count();
+}
+
+bool JetScapeRunMonitor::ShouldStop() {
+  if (target_rel_error_ > 0. && n_events_ >= n_min_events_ &&
+      GetMaxRelativeError() <= target_rel_error_) {
+    std::ostringstream reason;
+    reason << "all " << GetNumberOfBins()
+           << " pT bins reached relative error <= " << target_rel_error_
+           << " after " << n_events_ << " events";
+    stop_reason_ = reason.str();
+    return true;
+  }
+
+  if (max_wall_time_ > 0. && n_events_ > 0) {
+    // Stop if the next event is expected to overrun the budget
+    double elapsed = GetElapsedSeconds();
+    double per_event = elapsed / n_events_;
+    if (elapsed + per_event > max_wall_time_) {
+      std::ostringstream reason;
+      reason << "wall-time budget of " << max_wall_time_
+             << " s reached after " << n_events_ << " events ("
+             << elapsed << " s elapsed)";
+      stop_reason_ = reason.str();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void JetScapeRunMonitor::PrintStatus() const {
+  JSINFO << "Run monitor: " << n_events_ << " events, "
+         << GetElapsedSeconds() << " s";
+  for (unsigned int b = 0; b < sum_y_.size(); b++) {
+    JSINFO << "  pT [" << pt_edges_[b] << ", " << pt_edges_[b + 1]
+           << "] GeV: weighted yield = " << sum_y_[b]
+           << ", rel. error = " << GetRelativeError(b);
+  }
+}
+
+} // end namespace Jetscape
@@ -0,0 +1,106 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+/** Running observables for precision-targeted run termination.
+ * Accumulates the weighted final-state hadron yield in pT bins event by
+ * event and tells the event loop when every bin has reached the requested
+ * relative statistical uncertainty, or when the wall-time budget would be
+ * exceeded by running another event.
+ *
+ * The statistical error of a bin is estimated from the event-by-event
+ * spread of its weighted yield y_e = w_e * n_e:
+ *   sigma^2 = sum(y_e^2) - (sum y_e)^2 / N
+ * and the relative error is sigma / sum(y_e).
+ * Hadrons with negative status (holes from medium response) enter with
+ * negative sign, as in the standard analyses.
+ */
+
+#ifndef JETSCAPERUNMONITOR_H
+#define JETSCAPERUNMONITOR_H
+
+#include "JetScapeParticles.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Jetscape {
+
+class JetScapeRunMonitor {
+
+public:
+  JetScapeRunMonitor();
+
+  /// Relative error every bin must reach. A value <= 0 disables the criterion.
+  void SetTargetRelativeError(double target) { target_rel_error_ = target; }
+  double GetTargetRelativeError() const { return target_rel_error_; }
+
+  /// Bin edges in GeV; n edges define n-1 bins. Resets the accumulators.
+  void SetPtBinEdges(const std::vector<double> &edges);
+  const std::vector<double> &GetPtBinEdges() const { return pt_edges_; }
+
+  /// Only hadrons with |eta| < eta_max are counted.
+  void SetEtaMax(double eta_max) { eta_max_ = eta_max; }
+
+  /// Never stop on precision before this many events have been analysed.
+  void SetMinEvents(int n_min) { n_min_events_ = n_min; }
+
+  /// Wall-time budget in seconds. A value <= 0 disables the criterion.
+  void SetMaxWallTime(double seconds) { max_wall_time_ = seconds; }
+
+  /// Start the wall clock. Called right before the event loop.
+  void Start();
+
+  /// Accumulate one event.
+  void Fill(const std::vector<std::shared_ptr<Hadron>> &hadrons,
+            double event_weight);
+
+  /// Whether the run should end after the current event.
+  /// The reason is available through GetStopReason().
+  bool ShouldStop();
+
+  unsigned int GetNumberOfBins() const { return sum_y_.size(); }
+  long GetNumberOfEvents() const { return n_events_; }
+  double GetYield(unsigned int bin) const { return sum_y_.at(bin); }
+  /// Relative statistical error of a bin; infinite while it is empty.
+  double GetRelativeError(unsigned int bin) const;
+  double GetMaxRelativeError() const;
+  double GetElapsedSeconds() const;
+
+  const std::string &GetStopReason() const { return stop_reason_; }
+
+  /// Short summary of the bins for the log.
+  void PrintStatus() const;
+
+private:
+  double target_rel_error_;
+  double eta_max_;
+  int n_min_events_;
+  double max_wall_time_;
+
+  std::vector<double> pt_edges_;
+  std::vector<double> sum_y_;
+  std::vector<double> sum_y2_;
+  std::vector<double> event_y_;
+  long n_events_;
+
+  std::chrono::steady_clock::time_point start_;
+  std::string stop_reason_;
+};
+
+} // end namespace Jetscape
+
+#endif // JETSCAPERUNMONITOR_H
@@ -62,6 +62,14 @@ public:
   void SetHydroPointer(shared_ptr<FluidDynamics> m_hydro) { hydro = m_hydro; }
   weak_ptr<FluidDynamics> GetHydroPointer() { return hydro; }
 
+  /// Second hydro pass, e.g. the one with jet source terms from a liquefier
+  void SetSourceTermHydroPointer(shared_ptr<FluidDynamics> m_hydro) {
+    source_term_hydro = m_hydro;
+  }
+  weak_ptr<FluidDynamics> GetSourceTermHydroPointer() {
+    return source_term_hydro;
+  }
+
   void SetSoftParticlizationPointer(shared_ptr<SoftParticlization> m_soft) {
     softparticlization = m_soft;
   }
@@ -154,6 +162,7 @@ private:
   weak_ptr<InitialState> initial_state;
   weak_ptr<PreequilibriumDynamics> pre_equilibrium;
   weak_ptr<FluidDynamics> hydro;
+  weak_ptr<FluidDynamics> source_term_hydro;
   weak_ptr<JetEnergyLossManager> jloss;
   weak_ptr<HardProcess> hardp;
   weak_ptr<JetScapeWriter> writer;
@@ -116,7 +116,9 @@ shared_ptr<std::mt19937> JetScapeTaskSupport::GetMt19937Generator(int TaskId) {
     JSDEBUG << "Asked by " << TaskId
             << " for an individual generator, returning one seeded with "
             << localseed;
-    return make_shared<std::mt19937>(localseed);
+    auto generator = make_shared<std::mt19937>(localseed);
+    task_generators_.emplace_back(TaskId, generator);
+    return generator;
   }
 
   // this singleton owns the generator(s) and keeps them until deletion
@@ -126,6 +128,54 @@ shared_ptr<std::mt19937> JetScapeTaskSupport::GetMt19937Generator(int TaskId) {
   return one_for_all_;
 }
 
+// ---------------------------------------------------------------------------
+unsigned int JetScapeTaskSupport::ReseedForWorker(unsigned int worker,
+                                                  unsigned int attempt) {
+  if (!initialized_) {
+    throw std::runtime_error(
+        "Trying to use JetScapeTaskSupport::ReseedForWorker before "
+        "initialization");
+  }
+
+  std::seed_seq sequence{random_seed_, worker, attempt};
+  unsigned int seed = 0;
+  sequence.generate(&seed, &seed + 1);
+  // 0 means "random" to most modules, so keep clear of it
+  random_seed_ = seed == 0 ? 1 : seed;
+  one_for_all_->seed(random_seed_);
+
+  // Engines held by the tasks are reseeded in place, so modules that
+  // cached their handle during Init see the new stream
+  if (one_generator_per_task_) {
+    std::mt19937 seeder;
+    for (auto &task_generator : task_generators_) {
+      auto generator = task_generator.second.lock();
+      if (!generator)
+        continue;
+      seeder.seed(random_seed_);
+      seeder.discard(task_generator.first);
+      generator->seed(seeder());
+    }
+  }
+
+  JSINFO << "JetScapeTaskSupport reseeded worker " << worker << " (attempt "
+         << attempt << ") to " << random_seed_;
+  return random_seed_;
+}
+
+// ---------------------------------------------------------------------------
+
+void JetScapeTaskSupport::SeedVariantGenerator(std::mt19937 &generator,
+                                               const std::string &section,
+                                               const std::string &variant,
+                                               int event) {
+  std::vector<unsigned int> words{random_seed_, (unsigned int)event};
+  for (char c : section + '/' + variant)
+    words.push_back((unsigned char)c);
+  std::seed_seq sequence(words.begin(), words.end());
+  generator.seed(sequence);
+}
+
 // ---------------------------------------------------------------------------
 
 } // end namespace Jetscape
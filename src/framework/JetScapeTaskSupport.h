@@ -43,7 +43,10 @@
 #include <atomic>
 #include <memory>
 #include <random>
+#include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 using std::atomic_int;
 
@@ -72,6 +75,21 @@ public:
   /// every task gets their own
   shared_ptr<std::mt19937> GetMt19937Generator(int TaskId);
 
+  /// Moves every engine handed out so far, and all later ones, onto a new
+  /// seed derived from the xml seed, the worker number and the restart
+  /// attempt. Used by the fork server in each forked worker, so workers do
+  /// not repeat the random stream of the initialized parent.
+  /// Returns the new seed.
+  unsigned int ReseedForWorker(unsigned int worker, unsigned int attempt);
+
+  /// Seeds the engine of a variant (see <Variants> in Eloss and
+  /// JetHadronization) from the xml seed, the event number, the section and
+  /// the variant name. Variants draw from their own engine, so enabling them
+  /// does not change the random stream of the main run.
+  static void SeedVariantGenerator(std::mt19937 &generator,
+                                   const std::string &section,
+                                   const std::string &variant, int event);
+
   // Getters
   static unsigned int GetRandomSeed() { return random_seed_; };
 
@@ -88,6 +106,9 @@ private:
   static bool initialized_;
 
   static shared_ptr<std::mt19937> one_for_all_;
+
+  /// Individual engines handed out so far, with the task id they belong to
+  std::vector<std::pair<int, std::weak_ptr<std::mt19937>>> task_generators_;
 };
 
 } // end namespace Jetscape
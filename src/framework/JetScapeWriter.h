@@ -23,6 +23,7 @@
 #include "PartonShower.h"
 #include "JetClass.h"
 #include "JetScapeEventHeader.h"
+#include "JetScapeOutputSelection.h"
 
 using std::to_string;
 
@@ -64,9 +65,19 @@ public:
 
   virtual JetScapeEventHeader &GetHeader() { return header; };
 
+  /// Particle cuts applied before formatting, see JetScapeOutputSelection
+  JetScapeOutputSelection &GetOutputSelection() { return output_selection; }
+
+  /// Name of the parameter variant whose output this writer receives,
+  /// empty for the main run
+  void SetVariant(string m_variant) { variant = m_variant; }
+  string GetVariant() const { return variant; }
+
 protected:
   string file_name_out;
+  string variant;
   JetScapeEventHeader header;
+  JetScapeOutputSelection output_selection;
 };
 
 } // end namespace Jetscape
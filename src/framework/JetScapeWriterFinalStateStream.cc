@@ -130,13 +130,14 @@ void JetScapeWriterFinalStateStream<T>::Write(weak_ptr<PartonShower> ps) {
 
   // Store final state partons.
   for (const auto parton : finalStatePartons) {
+    if (output_selection.Accept(*parton))
       particles.push_back(parton);
   }
 }
 
 template <class T> void JetScapeWriterFinalStateStream<T>::Write(weak_ptr<Hadron> h) {
   auto hh = h.lock();
-  if (hh) {
+  if (hh && output_selection.Accept(*hh)) {
     particles.push_back(hh);
   }
 }
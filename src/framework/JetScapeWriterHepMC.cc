@@ -291,7 +291,7 @@ void JetScapeWriterHepMC::Write(weak_ptr<PartonShower> ps) {
 
 void JetScapeWriterHepMC::Write(weak_ptr<Hadron> h) {
   auto hadron = h.lock();
-  if (!hadron)
+  if (!hadron || !output_selection.Accept(*hadron))
     return;
 
   // No clear source for most hadrons
@@ -212,7 +212,7 @@ template <class T> void JetScapeWriterQnVectorStream<T>::Exec() {
 
 template <class T> void JetScapeWriterQnVectorStream<T>::Write(weak_ptr<Hadron> h) {
   auto hh = h.lock();
-  if (hh) {
+  if (hh && output_selection.Accept(*hh)) {
     particles.push_back(hh);
   }
 }
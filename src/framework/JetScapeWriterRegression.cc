@@ -0,0 +1,158 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "JetScapeWriterRegression.h"
+#include "JetScapeRegressionRecord.h"
+#include "JetScapeLogger.h"
+
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace Jetscape {
+
+// Register the module with the base class
+RegisterJetScapeModule<JetScapeWriterRegression>
+    JetScapeWriterRegression::reg("JetScapeWriterRegression");
+
+JetScapeWriterRegression::JetScapeWriterRegression(string m_file_name_out) {
+  SetOutputFileName(m_file_name_out);
+}
+
+JetScapeWriterRegression::~JetScapeWriterRegression() {
+  VERBOSE(8);
+  if (GetActive())
+    Close();
+}
+
+void JetScapeWriterRegression::Init() {
+  if (GetActive()) {
+    JSINFO << "JetScape Regression Writer initialized with output file = "
+           << GetOutputFileName();
+    output_file.open(GetOutputFileName().c_str());
+    output_file << std::hexfloat;
+    output_file << "#\t" << RegressionFileTag << "\tv"
+                << RegressionFileVersion << "\n";
+  }
+}
+
+void JetScapeWriterRegression::WriteHeaderToFile() {
+  output_file << "E\t" << GetCurrentEvent() << "\t"
+              << GetHeader().GetEventWeight() << "\t"
+              << GetHeader().GetPtHat() << "\n";
+}
+
+void JetScapeWriterRegression::WriteComment(string s) {
+  // Modules announce themselves with "<description>: <id>", see
+  // HardProcess, JetEnergyLoss and Hadronization WriteTask()
+  static const std::vector<std::pair<std::string, std::string>> sections = {
+      {"HardProcess Parton List: ", "Hard"},
+      {"Energy loss Shower Initating Parton: ", "Shower"},
+      {"Hadronization module: ", "Hadronization"}};
+
+  for (const auto &sec : sections) {
+    if (s.compare(0, sec.first.size(), sec.first) == 0) {
+      output_file << "M\t" << sec.second << "\t"
+                  << s.substr(sec.first.size()) << "\n";
+      return;
+    }
+  }
+}
+
+void JetScapeWriterRegression::WriteLocation(std::ostream &os,
+                                             const FourVector &x) {
+  os << "\t" << x.x() << "\t" << x.y() << "\t" << x.z() << "\t" << x.t();
+}
+
+void JetScapeWriterRegression::WriteParticle(std::ostream &os,
+                                             JetScapeParticleBase &p) {
+  os << "\t" << p.px() << "\t" << p.py() << "\t" << p.pz() << "\t" << p.e();
+  WriteLocation(os, p.x_in());
+}
+
+void JetScapeWriterRegression::WriteParton(std::ostream &os, int src, int tgt,
+                                           Parton &p) {
+  os << "P\t" << src << "\t" << tgt << "\t" << p.plabel() << "\t" << p.pid()
+     << "\t" << p.pstat() << "\t" << p.color() << "\t" << p.anti_color();
+  WriteParticle(os, p);
+  os << "\t" << p.t() << "\n";
+}
+
+void JetScapeWriterRegression::Write(weak_ptr<Parton> p) {
+  auto pp = p.lock();
+  if (pp)
+    WriteParton(output_file, -1, -1, *pp);
+}
+
+void JetScapeWriterRegression::Write(weak_ptr<Vertex> v) {
+  auto vv = v.lock();
+  if (!vv)
+    return;
+  output_file << "V\t-1";
+  WriteLocation(output_file, vv->x_in());
+  output_file << "\n";
+}
+
+void JetScapeWriterRegression::Write(weak_ptr<PartonShower> ps) {
+  auto pShower = ps.lock();
+  if (!pShower)
+    return;
+
+  // Vertices and partons no module claimed (the initiating one) stay in the
+  // shower section, every other parton goes to a section "Eloss <module>"
+  // of the module that produced it, in order of first appearance.
+  PartonShower::node_iterator nIt, nEnd;
+  for (nIt = pShower->nodes_begin(), nEnd = pShower->nodes_end(); nIt != nEnd;
+       ++nIt) {
+    output_file << "V\t" << nIt->id();
+    WriteLocation(output_file, pShower->GetVertex(*nIt)->x_in());
+    output_file << "\n";
+  }
+
+  std::vector<std::string> modules;
+  std::map<std::string, std::ostringstream> sections;
+  PartonShower::edge_iterator eIt, eEnd;
+  for (eIt = pShower->edges_begin(), eEnd = pShower->edges_end(); eIt != eEnd;
+       ++eIt) {
+    auto pp = pShower->GetParton(*eIt);
+    std::string module = pp->GetController();
+    if (module.empty()) {
+      WriteParton(output_file, eIt->source().id(), eIt->target().id(), *pp);
+      continue;
+    }
+    if (!sections.count(module)) {
+      modules.push_back(module);
+      sections[module] << std::hexfloat;
+    }
+    WriteParton(sections[module], eIt->source().id(), eIt->target().id(),
+                *pp);
+  }
+
+  for (const auto &module : modules) {
+    output_file << "M\tEloss\t" << module << "\n" << sections[module].str();
+  }
+}
+
+void JetScapeWriterRegression::Write(weak_ptr<Hadron> h) {
+  auto hh = h.lock();
+  if (!hh)
+    return;
+  output_file << "H\t" << hh->plabel() << "\t" << hh->pid() << "\t"
+              << hh->pstat();
+  WriteParticle(output_file, *hh);
+  output_file << "\n";
+}
+
+} // end namespace Jetscape
@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+// Jetscape regression writer
+// Writes the full event record (hard partons, shower graphs, hadrons) with
+// every floating point number in hexadecimal notation, so that two runs can
+// be compared bit by bit. Records are grouped in sections named after the
+// module that wrote them; shower partons after the energy loss module that
+// produced them. See JetScapeRegressionRecord.h for the format and the
+// comparison.
+
+#ifndef JETSCAPEWRITERREGRESSION_H
+#define JETSCAPEWRITERREGRESSION_H
+
+#include <fstream>
+#include <string>
+
+#include "JetScapeWriter.h"
+
+namespace Jetscape {
+
+class JetScapeWriterRegression : public JetScapeWriter {
+
+public:
+  JetScapeWriterRegression(){};
+  JetScapeWriterRegression(string m_file_name_out);
+  virtual ~JetScapeWriterRegression();
+
+  void Init();
+  void Exec(){};
+
+  bool GetStatus() { return output_file.good(); }
+  void Close() { output_file.close(); }
+
+  void Write(weak_ptr<Parton> p);
+  void Write(weak_ptr<Vertex> v);
+  void Write(weak_ptr<PartonShower> ps);
+  void Write(weak_ptr<Hadron> h);
+
+  /// Module comments open a new section; everything else is ignored
+  void WriteComment(string s);
+  void WriteWhiteSpace(string s){};
+  void Write(string s){};
+
+  void WriteHeaderToFile();
+  void WriteEvent(){};
+
+protected:
+  void WriteParticle(std::ostream &os, JetScapeParticleBase &p);
+  void WriteLocation(std::ostream &os, const FourVector &x);
+  void WriteParton(std::ostream &os, int src, int tgt, Parton &p);
+
+  std::ofstream output_file;
+
+  // Allows the registration of the module so that it is available to be used by the Jetscape framework.
+  static RegisterJetScapeModule<JetScapeWriterRegression> reg;
+};
+
+} // end namespace Jetscape
+
+#endif // JETSCAPEWRITERREGRESSION_H
@@ -83,8 +83,19 @@ template <class T> void JetScapeWriterStream<T>::WriteEvent() {
   // do nothing, the modules handle this
 }
 
+template <class T> void JetScapeWriterStream<T>::WriteWhiteSpace(string s) {
+  // With an output selection, the "[i] H" prefix of a hadron is only
+  // written once the hadron is accepted
+  if (output_selection.IsActive()) {
+    pending_prefix += s + " ";
+  } else {
+    output_file << s << " ";
+  }
+}
+
 template <class T> void JetScapeWriterStream<T>::Write(weak_ptr<Parton> p) {
   auto pp = p.lock();
+  FlushPrefix();
   if (pp) {
     output_file << *pp << endl;
   }
@@ -92,6 +103,7 @@ template <class T> void JetScapeWriterStream<T>::Write(weak_ptr<Parton> p) {
 
 template <class T> void JetScapeWriterStream<T>::Write(weak_ptr<Vertex> v) {
   auto vv = v.lock();
+  FlushPrefix();
   if (vv) {
     output_file << *vv << endl;
   }
@@ -165,6 +177,11 @@ void JetScapeWriterStream<T>::Write(weak_ptr<PartonShower> ps) {
 
 template <class T> void JetScapeWriterStream<T>::Write(weak_ptr<Hadron> h) {
   auto hh = h.lock();
+  if (hh && !output_selection.Accept(*hh)) {
+    pending_prefix.clear();
+    return;
+  }
+  FlushPrefix();
   if (hh) {
     output_file << *hh << endl;
   }
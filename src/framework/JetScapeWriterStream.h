@@ -54,14 +54,23 @@ public:
   //void Write(weak_ptr<Qvector> Qv);
   void WriteHeaderToFile();
 
-  void Write(string s) { output_file << s << endl; }
-  void WriteComment(string s) { output_file << "# " << s << endl; }
-  void WriteWhiteSpace(string s) { output_file << s << " "; }
+  void Write(string s) { FlushPrefix(); output_file << s << endl; }
+  void WriteComment(string s) { FlushPrefix(); output_file << "# " << s << endl; }
+  void WriteWhiteSpace(string s);
   void WriteEvent();
 
 protected:
+  /// Writes a line prefix held back for a particle that may be rejected
+  void FlushPrefix() {
+    if (!pending_prefix.empty()) {
+      output_file << pending_prefix;
+      pending_prefix.clear();
+    }
+  }
+
   T output_file; //!< Output file
   //int m_precision; //!< Output precision
+  string pending_prefix; //!< only used with an active output selection
 
   // Allows the registration of the module so that it is available to be used by the Jetscape framework.
   static RegisterJetScapeModule<JetScapeWriterStream<ofstream>> reg;
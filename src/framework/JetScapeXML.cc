@@ -216,6 +216,21 @@ tinyxml2::XMLElement *
 JetScapeXML::GetElement(std::initializer_list<const char *> path,
                         bool isRequired /* = true */) {
 
+  // Try to get value from the active parameter variant
+  if (override_element_ && path.size() > 1 &&
+      override_section_ == *path.begin()) {
+    tinyxml2::XMLElement *element = override_element_;
+    for (auto it = path.begin() + 1; element && it != path.end(); ++it)
+      element = element->FirstChildElement(*it);
+    if (element) {
+      VERBOSE(3) << "Loaded " << path << " from variant "
+                 << (override_element_->Attribute("name")
+                         ? override_element_->Attribute("name")
+                         : "");
+      return element;
+    }
+  }
+
   // Try to get value from User XML file
   tinyxml2::XMLElement *elementUser = GetXMLElementUser(path);
   if (elementUser) {
@@ -95,6 +95,15 @@ public:
   double GetElementDouble(std::initializer_list<const char *> path,
                           bool isRequired = true);
 
+  // Parameter variants: while an override is set, paths below <section> are
+  // looked up among the children of element first, e.g. the children of a
+  // <Variant> replace the same-named elements of the block during Init.
+  // Pass nullptr to remove it.
+  void SetOverride(const std::string &section, tinyxml2::XMLElement *element) {
+    override_section_ = section;
+    override_element_ = element;
+  }
+
 private:
   JetScapeXML() {
     xml_main_file_name = "";
@@ -122,6 +131,9 @@ private:
 
   std::string xml_user_file_name;
   bool xml_user_file_open;
+
+  std::string override_section_;
+  tinyxml2::XMLElement *override_element_ = nullptr;
 };
 
 // Print the XML element path name
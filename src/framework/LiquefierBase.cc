@@ -88,14 +88,21 @@ void LiquefierBase::check_energy_momentum_conservation(
 }
 
 void LiquefierBase::filter_partons(std::vector<Parton> &pOut) {
-  // threshold_energy_switch = 1, use e_threshold
-  // threshold_energy_switch = 0, use |e_threshold|*T
-  threshold_energy_switch = JetScapeXML::Instance()->GetElementInt({"Liquefier", "threshold_energy_switch"});
-  if (threshold_energy_switch != 0 && threshold_energy_switch != 1) {
-    JSWARN << "threshold_energy_switch should be 0 or 1, but it is " << threshold_energy_switch;
-    exit(1);
-  }
-  e_threshold = JetScapeXML::Instance()->GetElementDouble({"Liquefier", "e_threshold"}); // GeV
+  // read once, this runs for every vertex of every shower
+  std::call_once(thresholds_read, [this]() {
+    // threshold_energy_switch = 1, use e_threshold
+    // threshold_energy_switch = 0, use |e_threshold|*T
+    int energy_switch = JetScapeXML::Instance()->GetElementInt(
+        {"Liquefier", "threshold_energy_switch"});
+    if (energy_switch != 0 && energy_switch != 1) {
+      JSWARN << "threshold_energy_switch should be 0 or 1, but it is "
+             << energy_switch;
+      exit(1);
+    }
+    threshold_energy_switch = energy_switch;
+    e_threshold = JetScapeXML::Instance()->GetElementDouble(
+        {"Liquefier", "e_threshold"}); // GeV
+  });
 
   for (auto &iparton : pOut) {
     if (iparton.pstat() == miss_stat)
@@ -21,6 +21,7 @@
 #include "FluidCellInfo.h"
 
 #include <array>
+#include <mutex>
 #include <vector>
 #include "RealType.h"
 
@@ -55,12 +56,17 @@ private:
   const Jetscape::real hydro_source_abs_err;
   bool threshold_energy_switch;
   double e_threshold;
+  std::once_flag thresholds_read;
+  std::mutex droplet_mutex; // showers may add droplets concurrently
 
 public:
   LiquefierBase();
   ~LiquefierBase() { Clear(); }
 
-  void add_a_droplet(Droplet droplet_in) { dropletlist.push_back(droplet_in); }
+  void add_a_droplet(Droplet droplet_in) {
+    std::lock_guard<std::mutex> lock(droplet_mutex);
+    dropletlist.push_back(droplet_in);
+  }
 
   int get_drop_stat() const { return (drop_stat); }
   int get_miss_stat() const { return (miss_stat); }
@@ -70,6 +76,10 @@ public:
 
   void check_energy_momentum_conservation(const std::vector<Parton> &pIn,
                                           std::vector<Parton> &pOut);
+  // Called by JetEnergyLoss::DoShower for the partons of a single vertex
+  // (or a single freestreaming parton); the shower graph is never rescanned.
+  // Soft partons and holes are marked here, before they propagate, so that
+  // each droplet conserves energy-momentum at its own vertex.
   void filter_partons(std::vector<Parton> &pOut);
   void add_hydro_sources(std::vector<Parton> &pIn, std::vector<Parton> &pOut);
 
@@ -290,7 +290,7 @@ void PartonShower::load_edge_info_handler(edge e, GML_pair *read) {
     tmp = tmp->next;
   }
 
-  pMap[e] = make_shared<Parton>(plabel, pid, pstat, pT, eta, phi, E);
+  pMap[e] = MakeEventShared<Parton>(plabel, pid, pstat, pT, eta, phi, E);
 }
 
 void PartonShower::load_node_info_handler(node n, GML_pair *read) {
@@ -316,7 +316,7 @@ void PartonShower::load_node_info_handler(node n, GML_pair *read) {
     tmp = tmp->next;
   }
 
-  vMap[n] = make_shared<Vertex>(x, y, z, t);
+  vMap[n] = MakeEventShared<Vertex>(x, y, z, t);
 }
 
 // use with graphviz (on Mac: brew install graphviz --with-app)
@@ -48,10 +48,10 @@ void PartonShowerGenerator::DoShower(JetEnergyLoss &j) {
   pIn.push_back(*j.GetShowerInitiatingParton());
 
   // Add here the Hard Shower emitting parton ...
-  vStart = j.GetShower()->new_vertex(make_shared<Vertex>());
-  vEnd = j.GetShower()->new_vertex(make_shared<Vertex>());
+  vStart = j.GetShower()->new_vertex(MakeEventShared<Vertex>());
+  vEnd = j.GetShower()->new_vertex(MakeEventShared<Vertex>());
   j.GetShower()->new_parton(
-      vStart, vEnd, make_shared<Parton>(*j.GetShowerInitiatingParton()));
+      vStart, vEnd, MakeEventShared<Parton>(*j.GetShowerInitiatingParton()));
 
   // start then the recursive shower ...
   vStartVec.push_back(vEnd);
@@ -90,9 +90,9 @@ void PartonShowerGenerator::DoShower(JetEnergyLoss &j) {
       // --------------------------------------------
       for (int k = 0; k < pOutTemp.size(); k++) {
         vEnd = j.GetShower()->new_vertex(
-            make_shared<Vertex>(0, 0, 0, currentTime));
+            MakeEventShared<Vertex>(0, 0, 0, currentTime));
         j.GetShower()->new_parton(vStart, vEnd,
-                                  make_shared<Parton>(pOutTemp[k]));
+                                  MakeEventShared<Parton>(pOutTemp[k]));
 
         //DEBUG:
         //cout<<vStart<<"-->"<<vEnd<<endl;
@@ -119,9 +119,9 @@ void PartonShowerGenerator::DoShower(JetEnergyLoss &j) {
 
           for (int l = 1; l < pInTempModule.size(); l++) {
             node vNewRootNode = j.GetShower()->new_vertex(
-                make_shared<Vertex>(0, 0, 0, currentTime - j.GetDeltaT()));
+                MakeEventShared<Vertex>(0, 0, 0, currentTime - j.GetDeltaT()));
             j.GetShower()->new_parton(vNewRootNode, vEnd,
-                                      make_shared<Parton>(pInTempModule[l]));
+                                      MakeEventShared<Parton>(pInTempModule[l]));
           }
         }
         // --------------------------------------------
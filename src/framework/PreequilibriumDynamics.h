@@ -21,6 +21,7 @@
 #include "JetScapeModuleBase.h"
 #include "FluidCellInfo.h"
 #include "RealType.h"
+#include "TmunuField.h"
 
 namespace Jetscape {
 // Flags for preequilibrium dynamics status.
@@ -84,30 +85,23 @@ public:
   real GetPreequilibriumEndTime() { return (preequilibrium_tau_max_); }
 
   virtual int get_number_of_fluid_cells() { return(0); }
-  virtual void get_fluid_cell_with_index(
-          const int idx, std::unique_ptr<FluidCellInfo> &info_ptr) {}
+  /** Fills info with the idx-th cell of the evolution history, so that
+      hydro can write the history straight into its own storage. */
+  virtual void get_fluid_cell_with_index(const int idx, FluidCellInfo &info) {}
   virtual void clear_evolution_data() {}
 
   // record preequilibrium running status
   PreequilibriumStatus preequilibrium_status_;
 
-  std::vector<double> e_;
-  std::vector<double> P_;
-  std::vector<double> utau_;
-  std::vector<double> ux_;
-  std::vector<double> uy_;
-  std::vector<double> ueta_;
-  std::vector<double> pi00_;
-  std::vector<double> pi01_;
-  std::vector<double> pi02_;
-  std::vector<double> pi03_;
-  std::vector<double> pi11_;
-  std::vector<double> pi12_;
-  std::vector<double> pi13_;
-  std::vector<double> pi22_;
-  std::vector<double> pi23_;
-  std::vector<double> pi33_;
-  std::vector<double> bulk_Pi_;
+  /** @return The Tmunu field handed to hydro, read in place. */
+  const TmunuField &GetTmunuField() const { return tmunu_; }
+  /** Non-const access for hydro codes that take the component vectors by
+      non-const reference, such as MUSIC; they must not resize them. */
+  TmunuField &GetTmunuField() { return tmunu_; }
+
+protected:
+  /** Written in place by EvolvePreequilibrium(). */
+  TmunuField tmunu_;
 };
 
 } // end namespace Jetscape
@@ -46,7 +46,7 @@ public:
   SurfaceCellInfo() = default;
 
   /** Destructor. */
-  ~SurfaceCellInfo(){};
+  ~SurfaceCellInfo() = default;
 };
 
 } // namespace Jetscape
@@ -0,0 +1,96 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ * 
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#ifndef TMUNUFIELD_H
+#define TMUNUFIELD_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace Jetscape {
+
+/** Energy-momentum tensor of the medium on the initial-state grid, handed
+ *  from the pre-equilibrium stage to hydro. Each component is its own
+ *  std::vector<double> of size() cells, indexed like the initial-state
+ *  grid (see InitialState::CoordFromIdx). Producers fill the component
+ *  vectors in place and hydro modules take them by reference, so the
+ *  field is never copied between modules.
+ */
+class TmunuField {
+public:
+  /// Components, in storage order.
+  enum Component {
+    E,
+    P,
+    UTAU,
+    UX,
+    UY,
+    UETA,
+    PI00,
+    PI01,
+    PI02,
+    PI03,
+    PI11,
+    PI12,
+    PI13,
+    PI22,
+    PI23,
+    PI33,
+    BULK_PI,
+    NUM_COMPONENTS
+  };
+
+  std::vector<double> &operator[](Component c) { return components_[c]; }
+  const std::vector<double> &operator[](Component c) const {
+    return components_[c];
+  }
+
+  /** @return Number of cells, taken from the energy density. */
+  std::size_t size() const { return components_[E].size(); }
+
+  /** Sets every component to n cells, all zero. The component vectors
+   *  keep their capacity from event to event.
+   */
+  void Allocate(std::size_t n) {
+    for (auto &c : components_)
+      c.assign(n, 0.);
+  }
+
+  /** Empties every component, keeping its capacity. */
+  void clear() {
+    for (auto &c : components_)
+      c.clear();
+  }
+
+  /** Sets the field to an ideal fluid at rest, P = e/3 and
+   *  u = (1, 0, 0, 0), with one cell per entry of energy_density.
+   */
+  void FillIdealFluidAtRest(const std::vector<double> &energy_density) {
+    Allocate(energy_density.size());
+    for (std::size_t i = 0; i < energy_density.size(); i++) {
+      components_[E][i] = energy_density[i];
+      components_[P][i] = energy_density[i] / 3.;
+      components_[UTAU][i] = 1.;
+    }
+  }
+
+private:
+  std::array<std::vector<double>, NUM_COMPONENTS> components_;
+};
+
+} // end namespace Jetscape
+
+#endif // TMUNUFIELD_H
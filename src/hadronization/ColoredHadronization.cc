@@ -16,6 +16,8 @@
 #include "ColoredHadronization.h"
 #include "JetScapeXML.h"
 #include "JetScapeLogger.h"
+#include "HadronDecays.h"
+#include "JetScapePythiaStore.h"
 #include "tinyxml2.h"
 
 using namespace Jetscape;
@@ -25,9 +27,9 @@ using namespace Pythia8;
 RegisterJetScapeModule<ColoredHadronization>
     ColoredHadronization::reg("ColoredHadronization");
 
-Pythia8::Pythia ColoredHadronization::pythia("IntentionallyEmpty", false);
-
-ColoredHadronization::ColoredHadronization() {
+ColoredHadronization::ColoredHadronization()
+    : pythia(JetScapePythiaStore::Settings(),
+             JetScapePythiaStore::ParticleData(), false) {
   SetId("MyHadroTest");
   VERBOSE(8);
 }
@@ -107,6 +109,12 @@ void ColoredHadronization::Init() {
     pythia.readString("ParticleDecays:tau0Max = 10.0");
   }
 
+  // The HadronDecays task decays the hadrons after hadronization instead
+  if (HadronDecays::IsRequested()) {
+    JSINFO << "Hadron decays are done by the HadronDecays task.";
+    pythia.readString("HadronLevel:Decay = off");
+  }
+
   std::stringstream lines;
   lines << GetXMLElementText({"JetHadronization", "LinesToRead"}, false);
   while (std::getline(lines, s, '\n')) {
@@ -291,7 +299,7 @@ void ColoredHadronization::DoHadronization(
       continue; //To prevent "nan" from propagating, very rare though
 
     double x[4] = {0, 0, 0, 0};
-    hOut.push_back(make_shared<Hadron>(ip, event[i].id(), event[i].status(),
+    hOut.push_back(MakeEventShared<Hadron>(ip, event[i].id(), event[i].status(),
                                        event[i].pT(), event[i].eta(),
                                        event[i].phi(), event[i].e(), x));
     ++ip;
@@ -31,6 +31,7 @@ public:
                        vector<shared_ptr<Hadron>> &hOut,
                        vector<shared_ptr<Parton>> &pOut);
   void WriteTask(weak_ptr<JetScapeWriter> w);
+  void ReseedPrivateGenerators(unsigned int seed) { pythia.rndm.init(seed); }
 
 private:
   double p_fake;
@@ -39,7 +40,7 @@ private:
   static RegisterJetScapeModule<ColoredHadronization> reg;
 
 protected:
-  static Pythia8::Pythia pythia;
+  Pythia8::Pythia pythia; // one per instance, so that variants can differ
 };
 
 #endif // COLOREDHADRONIZATION_H
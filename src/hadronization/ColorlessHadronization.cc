@@ -16,6 +16,8 @@
 #include "ColorlessHadronization.h"
 #include "JetScapeXML.h"
 #include "JetScapeLogger.h"
+#include "HadronDecays.h"
+#include "JetScapePythiaStore.h"
 #include "tinyxml2.h"
 #include "JetScapeConstants.h"
 #include <sstream>
@@ -34,10 +36,9 @@ using namespace Pythia8;
 RegisterJetScapeModule<ColorlessHadronization>
     ColorlessHadronization::reg("ColorlessHadronization");
 
-// Initialize static helper here
-Pythia8::Pythia ColorlessHadronization::pythia("IntentionallyEmpty", false);
-
-ColorlessHadronization::ColorlessHadronization() {
+ColorlessHadronization::ColorlessHadronization()
+    : pythia(JetScapePythiaStore::Settings(),
+             JetScapePythiaStore::ParticleData(), false) {
   SetId("ColorlessHadronization");
   VERBOSE(8);
 }
@@ -102,6 +103,12 @@ void ColorlessHadronization::Init() {
     pythia.readString("ParticleDecays:tau0Max = 10.0");
   }
 
+  // The HadronDecays task decays the hadrons after hadronization instead
+  if (HadronDecays::IsRequested()) {
+    JSINFO << "Hadron decays are done by the HadronDecays task.";
+    pythia.readString("HadronLevel:Decay = off");
+  }
+
   std::stringstream lines;
   lines << GetXMLElementText({"JetHadronization", "LinesToRead"}, false);
   while (std::getline(lines, s, '\n')) {
@@ -169,18 +176,18 @@ void ColorlessHadronization::DoHadronization(
         //if (shower_in.at(ishower).at(ipart)->pstat()==0 && want_pos==1) pIn.push_back(shower_in.at(ishower).at(ipart));  // Positive
         if (want_pos == 1) { // Positive
           if (take_recoil && shower_in[ishower][ipart].pstat() == 1) {
-            pIn.push_back(make_shared<Parton>(shower_in[ishower][ipart]));
+            pIn.push_back(MakeEventShared<Parton>(shower_in[ishower][ipart]));
           }
           if (shower_in[ishower][ipart].pstat() == 0) {
-            pIn.push_back(make_shared<Parton>(shower_in[ishower][ipart]));
+            pIn.push_back(MakeEventShared<Parton>(shower_in[ishower][ipart]));
           }
           if (shower_in[ishower][ipart].pstat() == 22) {
-            pIn.push_back(make_shared<Parton>(shower_in[ishower][ipart])); //Allow photons with status code 22 to pass through Colorless hadronization.
+            pIn.push_back(MakeEventShared<Parton>(shower_in[ishower][ipart])); //Allow photons with status code 22 to pass through Colorless hadronization.
           }
         }
         if (take_recoil && shower_in[ishower][ipart].pstat() == -1 &&
             want_pos == 0) {
-          pIn.push_back(make_shared<Parton>(shower_in[ishower][ipart]));
+          pIn.push_back(MakeEventShared<Parton>(shower_in[ishower][ipart]));
         } // Negative
       }
       JSDEBUG << "Shower#" << ishower + 1
@@ -223,7 +230,7 @@ void ColorlessHadronization::DoHadronization(
       // First quark
       FourVector p1(rempx, rempy, rempz, reme);
       FourVector x1;
-      pIn.push_back(std::make_shared<Parton>(0, 1, 0, p1, x1));
+      pIn.push_back(MakeEventShared<Parton>(0, 1, 0, p1, x1));
       isquark[nquarks] = pIn.size() - 1;
       nquarks += 1;
       isdone[pIn.size() - 1] = 1;
@@ -232,7 +239,7 @@ void ColorlessHadronization::DoHadronization(
       // Second quark
       FourVector p2(rempx, rempy, -rempz, reme);
       FourVector x2;
-      pIn.push_back(std::make_shared<Parton>(0, 1, 0, p2, x2));
+      pIn.push_back(MakeEventShared<Parton>(0, 1, 0, p2, x2));
       isquark[nquarks] = pIn.size() - 1;
       nquarks += 1;
       isdone[pIn.size() - 1] = 1;
@@ -266,7 +273,7 @@ void ColorlessHadronization::DoHadronization(
         } else {
           FourVector p(rempx, rempy, rempz, reme);
           FourVector x;
-          pIn.push_back(std::make_shared<Parton>(0, 1, 0, p, x));
+          pIn.push_back(MakeEventShared<Parton>(0, 1, 0, p, x));
           isquark[nquarks] = pIn.size() - 1;
           nquarks += 1;
           isdone[pIn.size() - 1] = 1;
@@ -454,10 +461,10 @@ void ColorlessHadronization::DoHadronization(
         FourVector x;
         if (want_pos == 1)
           hOut.push_back(
-              std::make_shared<Hadron>(Hadron(0, ide, 0, p, x))); // Positive
+              MakeEventShared<Hadron>(Hadron(0, ide, 0, p, x))); // Positive
         else
           hOut.push_back(
-              std::make_shared<Hadron>(Hadron(0, ide, -1, p, x))); // Negative
+              MakeEventShared<Hadron>(Hadron(0, ide, -1, p, x))); // Negative
         //JSINFO << "Produced Hadron has id = " << pythia.event[ipart].id();
         // Print on output file
         //hadfile << pythia.event[ipart].px() << " " << pythia.event[ipart].py() << " " << pythia.event[ipart].pz() << " " << pythia.event[ipart].e() << " " << pythia.event[ipart].id() << " " << pythia.event[ipart].charge() << endl;
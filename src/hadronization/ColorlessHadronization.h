@@ -33,6 +33,7 @@ public:
                        vector<shared_ptr<Hadron>> &hOut,
                        vector<shared_ptr<Parton>> &pOut);
   void WriteTask(weak_ptr<JetScapeWriter> w);
+  void ReseedPrivateGenerators(unsigned int seed) { pythia.rndm.init(seed); }
 
 private:
   double p_fake;
@@ -42,7 +43,7 @@ private:
   static RegisterJetScapeModule<ColorlessHadronization> reg;
 
 protected:
-  static Pythia8::Pythia pythia;
+  Pythia8::Pythia pythia; // one per instance, so that variants can differ
   std::uniform_real_distribution<double> ZeroOneDistribution;
 };
 
@@ -0,0 +1,286 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#include "HadronDecays.h"
+#include "HadronizationManager.h"
+#include "Hadronization.h"
+#include "SoftParticlization.h"
+#include "JetScapeSignalManager.h"
+#include "JetScapeEventMemory.h"
+#include "JetScapeMemoryPlacement.h"
+#include "JetScapePythiaStore.h"
+#include "JetScapeXML.h"
+#include "JetScapeLogger.h"
+
+#include <algorithm>
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+namespace Jetscape {
+
+// Register the module with the base class
+RegisterJetScapeModule<HadronDecays> HadronDecays::reg("HadronDecays");
+
+namespace {
+
+// splitmix64 finalizer, turns (seed, index) into well separated seeds
+unsigned long MixSeed(unsigned long seed, unsigned long index) {
+  uint64_t z = (uint64_t)seed + 0x9e3779b97f4a7c15ULL * (index + 1);
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return (unsigned long)(z ^ (z >> 31));
+}
+
+// Pythia accepts seeds between 1 and 900000000
+int PythiaSeed(unsigned long seed) { return 1 + (int)(seed % 900000000UL); }
+
+void ReadLines(Pythia8::Pythia &pythia, const std::string &text) {
+  std::stringstream lines(text);
+  std::string s;
+  while (std::getline(lines, s, '\n')) {
+    if (s.find_first_not_of(" \t\v\f\r") == s.npos)
+      continue; // skip empty lines
+    JSINFO << "Also reading in: " << s;
+    pythia.readString(s);
+  }
+}
+
+} // namespace
+
+HadronDecays::HadronDecays()
+    : tau0Max_(10.0), n_threads_(1), pin_base_(0), chunk_size_(64),
+      decay_soft_(false) {
+  SetId("HadronDecays");
+  VERBOSE(8);
+}
+
+HadronDecays::~HadronDecays() { VERBOSE(8); }
+
+bool HadronDecays::IsRequested() {
+  auto root = JetScapeXML::Instance()->GetXMLRootUser();
+  return root && root->FirstChildElement("HadronDecays");
+}
+
+bool HadronDecays::FollowsHadronization(const tinyxml2::XMLElement *root,
+                                        bool soft) {
+  if (!root)
+    return true;
+  bool after_decays = false;
+  for (auto element = root->FirstChildElement(); element;
+       element = element->NextSiblingElement()) {
+    std::string name = element->Name();
+    if (name == "HadronDecays")
+      after_decays = true;
+    else if (after_decays && (name == "JetHadronization" ||
+                              (soft && name == "SoftParticlization")))
+      return false;
+  }
+  return true;
+}
+
+void HadronDecays::Init() {
+  JSINFO << "Initialize HadronDecays";
+
+  double tau0Max_xml = GetXMLElementDouble({"HadronDecays", "tau0Max"}, false);
+  if (tau0Max_xml >= 0) {
+    tau0Max_ = tau0Max_xml;
+  } else {
+    JSWARN << "tau0Max should be larger than 0. Set it to 10.";
+  }
+  // one thread unless asked for more, as for TRENTo; 0 takes all cores
+  n_threads_ = 1;
+  if (GetXMLElement({"HadronDecays", "n_threads"}, false)) {
+    int threads_xml = GetXMLElementInt({"HadronDecays", "n_threads"});
+    n_threads_ = threads_xml > 0
+                     ? threads_xml
+                     : std::max(1u, std::thread::hardware_concurrency());
+  }
+  pin_base_ = JetScapeMemoryPlacement::ReservePool(n_threads_);
+  int chunk_xml = GetXMLElementInt({"HadronDecays", "chunk_size"}, false);
+  if (chunk_xml > 0)
+    chunk_size_ = chunk_xml;
+  decay_soft_ = GetXMLElementInt({"HadronDecays", "soft"}, false) == 1;
+
+  // The hadrons are taken from the tasks before this one
+  if (!FollowsHadronization(JetScapeXML::Instance()->GetXMLRootUser(),
+                            decay_soft_)) {
+    JSWARN << "HadronDecays has to come after JetHadronization"
+           << (decay_soft_ ? " and SoftParticlization" : "")
+           << " in the user xml";
+    throw std::runtime_error("Incompatible HadronDecays settings.");
+  }
+
+  // The decay tables are configured once, the workers copy them
+  master_.reset(new Pythia8::Pythia(JetScapePythiaStore::Settings(),
+                                    JetScapePythiaStore::ParticleData(),
+                                    false));
+  auto &pythia = *master_;
+  pythia.readString("Print:quiet = on");
+  pythia.readString("Next:numberShowInfo = 0");
+  pythia.readString("Next:numberShowProcess = 0");
+  pythia.readString("Next:numberShowEvent = 0");
+  pythia.readString("ProcessLevel:all = off");
+  pythia.readString("HadronLevel:Hadronize = off");
+  pythia.readString("HadronLevel:Decay = on");
+  pythia.readString("ParticleDecays:limitTau0 = on");
+  pythia.readString("ParticleDecays:tau0Max = " + std::to_string(tau0Max_));
+  pythia.readString("Random:setSeed = on");
+  pythia.readString("Random:seed = 1");
+
+  // Particle settings of the hadronization (e.g. 111:mayDecay = off) apply
+  // here as well, followed by the ones given for the decays only
+  ReadLines(pythia,
+            GetXMLElementText({"JetHadronization", "LinesToRead"}, false));
+  ReadLines(pythia, GetXMLElementText({"HadronDecays", "LinesToRead"}, false));
+
+  workers_.clear();
+  for (int i = 0; i < n_threads_; i++) {
+    workers_.emplace_back(
+        new Pythia8::Pythia(pythia.settings, pythia.particleData, false));
+    workers_.back()->init();
+  }
+
+  JSINFO << "Hadron decays for tau0 < " << tau0Max_ << " mm/c on "
+         << n_threads_ << " threads, " << chunk_size_ << " hadrons per chunk"
+         << (decay_soft_ ? ", including soft hadrons" : "");
+}
+
+bool HadronDecays::MayDecay(Pythia8::Pythia &pythia, const Hadron &h) const {
+  int id = h.pid();
+  return pythia.particleData.mayDecay(id) &&
+         pythia.particleData.canDecay(id) &&
+         pythia.particleData.tau0(id) <= tau0Max_;
+}
+
+void HadronDecays::DecayChunk(Pythia8::Pythia &pythia,
+                              const vector<shared_ptr<Hadron>> &hadrons,
+                              unsigned int begin, unsigned int end,
+                              unsigned long seed,
+                              vector<shared_ptr<Hadron>> &out) {
+  Pythia8::Event &event = pythia.event;
+  for (unsigned int i = begin; i < end; i++) {
+    const auto &h = hadrons[i];
+    if (!MayDecay(pythia, *h)) {
+      out.push_back(h);
+      continue;
+    }
+
+    pythia.rndm.init(PythiaSeed(MixSeed(seed, i)));
+    event.reset();
+    event.append(h->pid(), 1, 0, 0, h->px(), h->py(), h->pz(), h->e(),
+                 h->restmass());
+    if (!pythia.next()) {
+      JSWARN << "Decay of hadron " << h->pid() << " failed, keeping it";
+      out.push_back(h);
+      continue;
+    }
+
+    // The products keep the label, the status (e.g. the reco/frag codes of
+    // the hybrid hadronization) and the production point of the mother
+    int stat = h->pstat();
+    for (int ipart = 1; ipart < event.size(); ++ipart) {
+      if (!event[ipart].isFinal())
+        continue;
+      FourVector p(event[ipart].px(), event[ipart].py(), event[ipart].pz(),
+                   event[ipart].e());
+      out.push_back(MakeEventShared<Hadron>(
+          Hadron(h->plabel(), event[ipart].id(), stat, p, h->x_in(),
+                 event[ipart].m())));
+    }
+  }
+}
+
+void HadronDecays::DecayHadrons(vector<shared_ptr<Hadron>> &hadrons,
+                                unsigned long seed) {
+  if (hadrons.empty())
+    return;
+
+  unsigned int n_chunks = (hadrons.size() + chunk_size_ - 1) / chunk_size_;
+  vector<vector<shared_ptr<Hadron>>> results(n_chunks);
+
+  std::atomic<unsigned int> next_chunk(0);
+  auto work = [&](Pythia8::Pythia *pythia) {
+    unsigned int c;
+    while ((c = next_chunk++) < n_chunks) {
+      unsigned int begin = c * chunk_size_;
+      unsigned int end = std::min<unsigned int>(begin + chunk_size_,
+                                                hadrons.size());
+      DecayChunk(*pythia, hadrons, begin, end, seed, results[c]);
+    }
+  };
+
+  int n = std::min<int>(n_threads_, n_chunks);
+  if (n <= 1) {
+    work(workers_[0].get());
+  } else {
+    // keep allocating from the event memory pool in the workers
+    bool inEvent = JetScapeEventMemory::InEvent();
+    vector<std::thread> threads;
+    for (int t = 0; t < n; t++) {
+      Pythia8::Pythia *pythia = workers_[t].get();
+      unsigned int cpu = pin_base_ + t;
+      threads.push_back(std::thread([&work, inEvent, pythia, cpu]() {
+        JetScapeEventMemory::AttachThread(inEvent);
+        JetScapeMemoryPlacement::PinThread(cpu);
+        work(pythia);
+      }));
+    }
+    for (auto &t : threads)
+      t.join();
+  }
+
+  // Concatenate in chunk order, independent of the number of threads
+  hadrons.clear();
+  for (auto &r : results)
+    hadrons.insert(hadrons.end(), r.begin(), r.end());
+}
+
+void HadronDecays::Exec() {
+  VERBOSE(2) << "Run HadronDecays";
+  unsigned long seed = (*GetMt19937Generator())();
+  unsigned long list = 0;
+
+  auto hadroMgr = JetScapeSignalManager::Instance()
+                      ->GetHadronizationManagerPointer()
+                      .lock();
+  if (hadroMgr) {
+    for (auto it : hadroMgr->GetTaskList()) {
+      auto hadro = std::dynamic_pointer_cast<Hadronization>(it);
+      if (!hadro)
+        continue;
+      auto hadrons = hadro->GetHadrons();
+      unsigned int n_before = hadrons.size();
+      DecayHadrons(hadrons, MixSeed(seed, list++));
+      VERBOSE(2) << "HadronDecays: " << n_before << " -> " << hadrons.size()
+                 << " hadrons";
+      hadro->AddInHadrons(hadrons);
+    }
+  }
+
+  if (!decay_soft_)
+    return;
+  auto soft = JetScapeSignalManager::Instance()
+                  ->GetSoftParticlizationPointer()
+                  .lock();
+  if (soft) {
+    for (auto &hadrons : soft->Hadron_list_) {
+      DecayHadrons(hadrons, MixSeed(seed, list++));
+    }
+  }
+}
+
+} // end namespace Jetscape
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+// Hadron decay stage
+// Decays the hadrons of all hadronization modules (and optionally of the
+// soft particlization) after fragmentation, in one place. The hadronization
+// modules run with Pythia decays off when this task is in the user xml.
+// The hadron list is cut into chunks that are decayed on worker threads, each
+// with its own Pythia built from one decay table read at Init. Every hadron
+// gets its own random seed, derived from the event seed and its position in
+// the list, so the result does not depend on the number of threads. The decay
+// products keep the label, status and production point of their mother.
+
+#ifndef HADRONDECAYS_H
+#define HADRONDECAYS_H
+
+#include "JetScapeModuleBase.h"
+#include "JetClass.h"
+#include "Pythia8/Pythia.h"
+#include "tinyxml2.h"
+
+#include <memory>
+#include <vector>
+
+namespace Jetscape {
+
+class HadronDecays : public JetScapeModuleBase,
+                     public std::enable_shared_from_this<HadronDecays> {
+
+public:
+  HadronDecays();
+  virtual ~HadronDecays();
+
+  virtual void Init();
+  virtual void Exec();
+  virtual void Clear(){};
+
+  /// True if the user xml asks for the decay stage. Hadronization modules
+  /// use this to switch off their own Pythia decays.
+  static bool IsRequested();
+
+  /// Tasks run in the order of the user xml. True if <JetHadronization>, and
+  /// <SoftParticlization> when soft hadrons are decayed, do not come after
+  /// <HadronDecays> below root.
+  static bool FollowsHadronization(const tinyxml2::XMLElement *root,
+                                   bool soft);
+
+  /// Replace every hadron that may decay (tau0 <= tau0Max) by its decay
+  /// products, in place. Hadron i of the list is decayed with a seed derived
+  /// from (seed, i) only.
+  void DecayHadrons(vector<shared_ptr<Hadron>> &hadrons, unsigned long seed);
+
+  int GetNumberOfThreads() const { return n_threads_; }
+
+private:
+  void DecayChunk(Pythia8::Pythia &pythia,
+                  const vector<shared_ptr<Hadron>> &hadrons,
+                  unsigned int begin, unsigned int end, unsigned long seed,
+                  vector<shared_ptr<Hadron>> &out);
+  bool MayDecay(Pythia8::Pythia &pythia, const Hadron &h) const;
+
+  double tau0Max_;
+  int n_threads_;
+  unsigned int pin_base_; // first CPU index of the worker threads
+  int chunk_size_;
+  bool decay_soft_;
+
+  /// Reads the particle data once; the workers copy its tables.
+  std::unique_ptr<Pythia8::Pythia> master_;
+  std::vector<std::unique_ptr<Pythia8::Pythia>> workers_;
+
+  // Allows the registration of the module so that it is available to be used by the Jetscape framework.
+  static RegisterJetScapeModule<HadronDecays> reg;
+};
+
+} // end namespace Jetscape
+
+#endif // HADRONDECAYS_H
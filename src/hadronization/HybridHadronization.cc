@@ -17,6 +17,8 @@
 #include "ThermPtnSampler.h"
 #include "JetScapeXML.h"
 #include "JetScapeLogger.h"
+#include "HadronDecays.h"
+#include "JetScapePythiaStore.h"
 #include "tinyxml2.h"
 #include "JetScapeConstants.h"
 
@@ -41,9 +43,6 @@ using namespace Pythia8;
 // Register the module with the base class
 RegisterJetScapeModule<HybridHadronization> HybridHadronization::reg("HybridHadronization");
 
-// Initialize static helper here
-Pythia8::Pythia HybridHadronization::pythia ("IntentionallyEmpty",false);
-
 //RNG - Mersenne Twist - 64 bit
 //std::mt19937_64 eng(std::random_device{}());
 //std::mt19937_64 eng(1);
@@ -53,7 +52,15 @@ double HybridHadronization::ran() {
   return uniran(eng);
 }
 
-HybridHadronization::HybridHadronization(){
+// rand_seed also seeds the thermal parton samplers of later events
+void HybridHadronization::ReseedPrivateGenerators(unsigned int seed) {
+  rand_seed = seed;
+  eng.seed(rand_seed);
+  pythia.rndm.init(rand_seed);
+}
+
+HybridHadronization::HybridHadronization()
+  : pythia(JetScapePythiaStore::Settings(), JetScapePythiaStore::ParticleData(), false){
   SetId("HybridHadronization");
   VERBOSE(8);
 }
@@ -340,6 +347,13 @@ void HybridHadronization::Init(){
       pythia.readString("ParticleDecays:tau0Max = 10.0");
     }
 
+    // The HadronDecays task decays the hadrons after hadronization instead
+    if (HadronDecays::IsRequested()) {
+      JSINFO << "Hadron decays are done by the HadronDecays task.";
+      pythia_decays = "off";
+      pythia.readString("HadronLevel:Decay = off");
+    }
+
 	  //setting seed, or using random seed
 	  pythia.readString("Random:setSeed = on");
 	  pythia.readString("Random:seed = " + std::to_string(rand_seed));
@@ -686,8 +700,10 @@ void HybridHadronization::DoHadronization(vector<vector<shared_ptr<Parton>>>& sh
       // afterburner
       if(afterburner_frag_hadrons){
         reco_hadrons_pythia = 1;
-        pythia.readString("HadronLevel:Decay = on");
-        pythia.init();
+        if(!HadronDecays::IsRequested()){
+          //decays on top of the initialized configuration, see pythia_next()
+          decays_after_next = !pythia.flag("HadronLevel:Decay");
+        }
       }
 
       //add holes left by used thermal partons to HH_shower
@@ -869,7 +885,7 @@ void HybridHadronization::DoHadronization(vector<vector<shared_ptr<Parton>>>& sh
 		    int lab = (pos_ptn == 0) ? -1 : 1 ;
 	  	  int idH = HH_hadrons[iHad].id(); double mH = HH_hadrons[iHad].mass();
 		    FourVector p(HH_hadrons[iHad].P()); FourVector x(HH_hadrons[iHad].pos());
-		    hOut.push_back(std::make_shared<Hadron> (Hadron (lab,idH,stat,p,x,mH)));
+		    hOut.push_back(MakeEventShared<Hadron> (Hadron (lab,idH,stat,p,x,mH)));
 
         if(pos_ptn == 1){ // used for scaling of negative hadrons
           energy_hadrons += HH_hadrons[iHad].e();
@@ -879,7 +895,7 @@ void HybridHadronization::DoHadronization(vector<vector<shared_ptr<Parton>>>& sh
 	  th_recofactor = tmp_threco;
     maxB_level = tmp_maxB_level;
     reco_hadrons_pythia = tmp_reco_hadrons_pythia;
-    if(pythia_decays == "off"){pythia.readString("HadronLevel:Decay = off"); pythia.init();}
+    decays_after_next = false;
 	}
 }
 
@@ -6290,7 +6306,7 @@ bool HybridHadronization::invoke_py(){
         size_input = event.size()-1;
         //event.listJunctions();
         //event.list();
-        case1 &= pythia.next();
+        case1 &= pythia_next();
         //event.list();
         set_spacetime_for_pythia_hadrons(event,size_input,eve_to_had,attempt,case1,false,false);
         event.reset();
@@ -6310,7 +6326,7 @@ bool HybridHadronization::invoke_py(){
         size_input = event.size()-1;
         //event.listJunctions();
         //event.list();
-        case2 &= pythia.next();
+        case2 &= pythia_next();
         //event.list();
         set_spacetime_for_pythia_hadrons(event,size_input,eve_to_had,attempt,case2,false,false);
         event.reset();
@@ -6336,7 +6352,7 @@ bool HybridHadronization::invoke_py(){
 		//if this fails more than 10 times, we may retry this event starting back before recombination (some number of times)
     //event.listJunctions();
     //event.list();
-    case3 &= pythia.next();
+    case3 &= pythia_next();
     //event.list();
     set_spacetime_for_pythia_hadrons(event,size_input,eve_to_had,attempt,case3,false,false);
     event.reset();
@@ -6358,7 +6374,7 @@ bool HybridHadronization::invoke_py(){
 			    eve_to_had.push_back(i+1);
 		    }
       }
-      case4 &= pythia.next();
+      case4 &= pythia_next();
       set_spacetime_for_pythia_hadrons(event,size_input,eve_to_had,attempt,case4,true,true);
       event.reset();
       eve_to_had.clear();
@@ -6374,7 +6390,7 @@ bool HybridHadronization::invoke_py(){
 			    eve_to_had.push_back(i+1);
 		    }
       }
-      case5 &= pythia.next();
+      case5 &= pythia_next();
       set_spacetime_for_pythia_hadrons(event,size_input,eve_to_had,attempt,case5,true,false);
       event.reset();
       eve_to_had.clear();
@@ -6390,7 +6406,7 @@ bool HybridHadronization::invoke_py(){
 			    eve_to_had.push_back(i+1);
 		    }
       }
-      case6 &= pythia.next();
+      case6 &= pythia_next();
       set_spacetime_for_pythia_hadrons(event,size_input,eve_to_had,attempt,case6,false,false);
       event.reset();
       eve_to_had.clear();
@@ -6407,6 +6423,13 @@ bool HybridHadronization::invoke_py(){
 	return success;
 }
 
+bool HybridHadronization::pythia_next(){
+  //HadronLevel:Decay = on would need a new pythia.init(); moreDecays() performs the same decays
+  bool success = pythia.next();
+  if(success && decays_after_next){success = pythia.moreDecays();}
+  return success;
+}
+
 void HybridHadronization::set_spacetime_for_pythia_hadrons(Pythia8::Event &event, int &size_input, std::vector<int> &eve_to_had, int pythia_attempt, bool find_positions, bool is_recohadron, bool recohadron_shsh) {
   // directly return if hadronization in pythia failed, such that nothing is added to HH_pythia_hadrons
   if(!find_positions) {
@@ -36,6 +36,7 @@ class HybridHadronization : public HadronizationModule<HybridHadronization>
   void Init();
   void DoHadronization(vector<vector<shared_ptr<Parton>>>& shower, vector<shared_ptr<Hadron>>& hOut, vector<shared_ptr<Parton>>& pOut);
   void WriteTask(weak_ptr<JetScapeWriter> w);
+  void ReseedPrivateGenerators(unsigned int seed);
 
  private:
   // Allows the registration of the module so that it is available to be used by the Jetscape framework.
@@ -63,6 +64,7 @@ class HybridHadronization : public HadronizationModule<HybridHadronization>
   bool torder_reco;
   bool afterburner_frag_hadrons = false;
   std::string pythia_decays;
+  bool decays_after_next = false; // decay with moreDecays(), no re-init
 
   //variables for recombination color structure
   vector<vector<vector<int>>> Tempjunctions; // vector of all tempjunctions
@@ -362,6 +364,8 @@ class HybridHadronization : public HadronizationModule<HybridHadronization>
 
   //function to hand partons/strings and hadron resonances (and other color neutral objects) to Pythia8
   bool invoke_py();
+  //pythia.next(), followed by the decays that the configuration switched off if requested
+  bool pythia_next();
 
   // function to set the spacetime information for the hadrons coming from pythia
   void set_spacetime_for_pythia_hadrons(Pythia8::Event &event, int &size_input, std::vector<int> &eve_to_had, int pythia_attempt, bool find_positions, bool is_recohadron, bool recohadron_shsh);
@@ -377,7 +381,7 @@ class HybridHadronization : public HadronizationModule<HybridHadronization>
   void scale_kinematics_negative_hadrons(hadron_collection& HH_hadrons, double shower_energy, double positive_hadrons_energy);
 
   protected:
-	static Pythia8::Pythia pythia;
+	Pythia8::Pythia pythia; // one per instance, so that variants can differ
 
 };
 
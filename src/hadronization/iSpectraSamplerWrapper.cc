@@ -17,11 +17,18 @@
 // -----------------------------------------
 
 #include "JetScapeLogger.h"
+#include "JetScapeSignalManager.h"
+#include "FluidDynamics.h"
 #include "iSpectraSamplerWrapper.h"
 
+#include <unistd.h>
+
 #include <memory>
 #include <string>
+#include <sstream>
 #include <fstream>
+#include <filesystem>
+#include <stdexcept>
 
 using namespace Jetscape;
 
@@ -34,7 +41,12 @@ iSpectraSamplerWrapper::iSpectraSamplerWrapper() {
     statusCode_ = 0;
 }
 
-iSpectraSamplerWrapper::~iSpectraSamplerWrapper() {}
+iSpectraSamplerWrapper::~iSpectraSamplerWrapper() {
+  // holds nothing but the links to music_input and surface.dat
+  std::error_code ec;
+  if (!working_path_.empty())
+    std::filesystem::remove_all(working_path_, ec);
+}
 
 void iSpectraSamplerWrapper::InitTask() {
 
@@ -69,8 +81,35 @@ void iSpectraSamplerWrapper::InitTask() {
     hydro_mode = 2;
   }
 
-  iSpectraSampler_ptr_ = std::unique_ptr<iSS>(
-          new iSS(working_path, table_path, particle_table_path, input_file));
+  // private directory under iSS_working_path, so that tasks and jobs
+  // sharing it do not relink each other's surface.dat and music_input
+  std::ostringstream task_name;
+  task_name << GetId() << "_" << getpid() << "_" << GetMyTaskNumber();
+  std::error_code ec;
+  working_path_ = std::filesystem::absolute(
+      std::filesystem::path(working_path) / task_name.str(), ec);
+  if (!ec)
+    std::filesystem::create_directories(working_path_, ec);
+  if (ec) {
+    JSWARN << "Cannot create the iSS working directory " << working_path_
+           << ": " << ec.message();
+    working_path_.clear();
+    throw std::runtime_error("iSS has no working directory.");
+  }
+
+  // iSS reads the hydro parameters from music_input in its working path
+  std::string music_input_file_path = GetXMLElementText(
+          {"Hydro", "MUSIC", "MUSIC_input_file"});
+  std::filesystem::path music_input = working_path_ / "music_input";
+  std::filesystem::create_symlink(
+      std::filesystem::absolute(music_input_file_path, ec), music_input, ec);
+  if (ec) {
+    JSWARN << "Cannot link " << music_input << " to "
+           << music_input_file_path << ": " << ec.message();
+  }
+
+  iSpectraSampler_ptr_ = std::unique_ptr<iSS>(new iSS(
+      working_path_.string(), table_path, particle_table_path, input_file));
   iSpectraSampler_ptr_->paraRdr_ptr->readFromFile(input_file);
 
   // overwrite some parameters
@@ -119,23 +158,22 @@ void iSpectraSamplerWrapper::InitTask() {
 void iSpectraSamplerWrapper::Exec() {
   JSINFO << "running iSS ...";
 
-  // generate symbolic links with music_input_file
-  std::string music_input_file_path = GetXMLElementText(
-          {"Hydro", "MUSIC", "MUSIC_input_file"});
-  std::string working_path =
-      GetXMLElementText({"SoftParticlization", "iSS", "iSS_working_path"});
-  std::string music_input = working_path + "/music_input";
-  std::ifstream inputfile(music_input.c_str());
-  if (!inputfile.good()) {
-    std::ostringstream system_command;
-    system_command << "ln -s " << music_input_file_path << " "
-                   << music_input;
-    system(system_command.str().c_str());
-  }
-  inputfile.close();
-
   int nCells = getSurfCellVector();
   if (nCells == 0) {
+    // the surface is on disk, in the hydro module's own directory
+    auto hydro = JetScapeSignalManager::Instance()->GetHydroPointer().lock();
+    std::string surface_file = hydro ? hydro->GetSurfaceFile() : "";
+    if (!surface_file.empty()) {
+      std::error_code ec;
+      std::filesystem::path surface_link = working_path_ / "surface.dat";
+      std::filesystem::remove(surface_link, ec);
+      std::filesystem::create_symlink(
+          std::filesystem::absolute(surface_file, ec), surface_link, ec);
+      if (ec) {
+        JSWARN << "Cannot link " << surface_link << " to " << surface_file
+               << ": " << ec.message();
+      }
+    }
     int status = iSpectraSampler_ptr_->read_in_FO_surface();
     if (status != 0) {
       JSWARN << "Some errors happened in reading in the hyper-surface";
@@ -191,7 +229,7 @@ void iSpectraSamplerWrapper::PassHadronListToJetscape() {
                           current_hadron.t);
 
       // create a JETSCAPE Hadron
-      hadrons.push_back(make_shared<Hadron>(hadron_label, hadron_id,
+      hadrons.push_back(MakeEventShared<Hadron>(hadron_label, hadron_id,
                                             hadron_status, hadron_p, hadron_x,
                                             hadron_mass));
       //Hadron* jetscape_hadron = new Hadron(hadron_label, hadron_id, hadron_status, hadron_p, hadron_x, hadron_mass);
@@ -19,6 +19,7 @@
 #ifndef ISPECTRASAMPLERWRAPPER_H
 #define ISPECTRASAMPLERWRAPPER_H
 
+#include <filesystem>
 #include <memory>
 
 #include "SoftParticlization.h"
@@ -32,6 +33,7 @@ private:
 
   int statusCode_;
   std::unique_ptr<iSS> iSpectraSampler_ptr_;
+  std::filesystem::path working_path_; //!< per-task directory iSS reads from
 
   // Allows the registration of the module so that it is available to be used by the Jetscape framework.
   static RegisterJetScapeModule<iSpectraSamplerWrapper> reg;
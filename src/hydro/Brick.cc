@@ -86,8 +86,8 @@ void Brick::GetHydroInfo(
     Jetscape::real t, Jetscape::real x, Jetscape::real y, Jetscape::real z,
     //                           FluidCellInfo* fluid_cell_info_ptr) {
     std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
-  // create the unique FluidCellInfo here
-  fluid_cell_info_ptr = make_unique<FluidCellInfo>();
+  // create (or reuse) the unique FluidCellInfo here
+  ResetFluidCellInfo(fluid_cell_info_ptr);
 
   // assign all the quantites to JETSCAPE output
   // thermodyanmic quantities
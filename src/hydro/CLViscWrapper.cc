@@ -86,29 +86,30 @@ void CLVisc::InitializeHydro(Parameter parameter_list) {
 void CLVisc::EvolveHydro() {
   VERBOSE(8);
   JSINFO << "Initialize density profiles in CLVisc ...";
-  std::vector<double> entropy_density = ini->GetEntropyDensityDistribution();
+  const std::vector<double> &initial_density =
+      ini->GetEntropyDensityDistribution();
   double dx = ini->GetXStep();
   if (pre_eq_ptr == nullptr) {
     if (initial_condition_scale_factor == 1.0) {
-      hydro_->read_ini(entropy_density);
+      hydro_->read_ini(initial_density);
     } else {
+      std::vector<double> entropy_density = initial_density;
       std::for_each(
           entropy_density.begin(), entropy_density.end(),
           [&](double &sd) { sd = initial_condition_scale_factor * sd; });
       hydro_->read_ini(entropy_density);
     }
   } else {
-    std::vector<double> vx_, vy_, vz_;
-    for (size_t idx = 0; idx < pre_eq_ptr->ux_.size(); idx++) {
-      vx_.push_back(pre_eq_ptr->ux_.at(idx) / pre_eq_ptr->utau_.at(idx));
-      vy_.push_back(pre_eq_ptr->uy_.at(idx) / pre_eq_ptr->utau_.at(idx));
-      vz_.push_back(pre_eq_ptr->ueta_.at(idx) / pre_eq_ptr->utau_.at(idx));
-    }
-
-    hydro_->read_ini(pre_eq_ptr->e_, vx_, vy_, vz_, pre_eq_ptr->pi00_,
-                     pre_eq_ptr->pi01_, pre_eq_ptr->pi02_, pre_eq_ptr->pi03_,
-                     pre_eq_ptr->pi11_, pre_eq_ptr->pi12_, pre_eq_ptr->pi13_,
-                     pre_eq_ptr->pi22_, pre_eq_ptr->pi23_, pre_eq_ptr->pi33_);
+    // read the pre-equilibrium field in place
+    const TmunuField &tmunu = pre_eq_ptr->GetTmunuField();
+    const double *pi[10];
+    for (int k = 0; k < 10; k++)
+      pi[k] = tmunu[TmunuField::Component(TmunuField::PI00 + k)].data();
+    hydro_->read_ini(tmunu.size(), tmunu[TmunuField::E].data(),
+                     tmunu[TmunuField::UTAU].data(),
+                     tmunu[TmunuField::UX].data(),
+                     tmunu[TmunuField::UY].data(),
+                     tmunu[TmunuField::UETA].data(), pi);
   }
 
   hydro_status = INITIALIZED;
@@ -144,7 +145,7 @@ void CLVisc::EvolveHydro() {
 void CLVisc::GetHydroInfo(Jetscape::real t, Jetscape::real x, Jetscape::real y,
                           Jetscape::real z,
                           std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
-  fluid_cell_info_ptr = make_unique<FluidCellInfo>();
+  ResetFluidCellInfo(fluid_cell_info_ptr);
   if (hydro_status != FINISHED) {
     throw std::runtime_error("Hydro evolution is not finished ");
   }
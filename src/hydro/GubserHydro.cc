@@ -66,8 +66,8 @@ void GubserHydro::GetHydroInfo(
     Jetscape::real t, Jetscape::real x, Jetscape::real y, Jetscape::real z,
     //                                  FluidCellInfo* fluid_cell_info_ptr) {
     std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
-  // create the unique FluidCellInfo here
-  fluid_cell_info_ptr = make_unique<FluidCellInfo>();
+  // create (or reuse) the unique FluidCellInfo here
+  ResetFluidCellInfo(fluid_cell_info_ptr);
 
   double t_local = static_cast<double>(t);
   double x_local = static_cast<double>(x);
@@ -313,7 +313,7 @@ void HydroFromFile::GetHydroInfo(
 
   // assign all the quantites to JETSCAPE output
   // thermodyanmic quantities
-  fluid_cell_info_ptr = make_unique<FluidCellInfo>();
+  ResetFluidCellInfo(fluid_cell_info_ptr);
   fluid_cell_info_ptr->energy_density =
       (static_cast<Jetscape::real>(temp_fluid_cell_ptr->ed));
   fluid_cell_info_ptr->entropy_density =
@@ -15,12 +15,18 @@
 
 #include <stdio.h>
 #include <sys/stat.h>
+#include <unistd.h>
 #include <MakeUniqueHelper.h>
 
 #include <string>
 #include <sstream>
 #include <vector>
 #include <memory>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
 
 #include "JetScapeLogger.h"
 #include "MusicWrapper.h"
@@ -36,13 +42,20 @@ MpiMusic::MpiMusic() {
   freezeout_temperature = 0.0;
   doCooperFrye = 0;
   flag_output_evo_to_file = 0;
+  flag_store_evo_with_sources = 0;
   has_source_terms = false;
   SetId("MUSIC");
   hydro_source_terms_ptr =
       std::shared_ptr<HydroSourceJETSCAPE>(new HydroSourceJETSCAPE());
 }
 
-MpiMusic::~MpiMusic() {}
+MpiMusic::~MpiMusic() {
+  // the results, e.g. surface_<id>.dat, stay in the scratch directory;
+  // it is only removed if nothing was written to it
+  std::error_code ec;
+  if (!scratch_dir_.empty())
+    std::filesystem::remove(scratch_dir_, ec);
+}
 
 void MpiMusic::InitializeHydro(Parameter parameter_list) {
   JSINFO << "Initialize MUSIC ...";
@@ -71,6 +84,8 @@ void MpiMusic::InitializeHydro(Parameter parameter_list) {
   if (flag_output_evo_to_memory == 1) {
     music_hydro_ptr->set_parameter("store_hydro_info_in_memory", 1);
   }
+  flag_store_evo_with_sources = GetXMLElementInt(
+          {"Hydro", "MUSIC", "store_evolution_with_source_terms"});
 
   double tau_hydro = (
           GetXMLElementDouble({"Hydro", "MUSIC", "Initial_time_tau_0"}));
@@ -169,6 +184,22 @@ void MpiMusic::InitializeHydro(Parameter parameter_list) {
   }
 
   music_hydro_ptr->add_hydro_source_terms(hydro_source_terms_ptr);
+
+  // private directory for the files this task keeps, so that jobs
+  // sharing a working directory do not overwrite each other
+  std::ostringstream scratch_name;
+  scratch_name << GetId() << "_" << getpid() << "_" << GetMyTaskNumber();
+  std::error_code ec;
+  scratch_dir_ = std::filesystem::absolute(
+      std::filesystem::path("music_scratch") / scratch_name.str(), ec);
+  if (!ec)
+    std::filesystem::create_directories(scratch_dir_, ec);
+  if (ec) {
+    JSWARN << "Cannot create the MUSIC scratch directory " << scratch_dir_
+           << ": " << ec.message();
+    scratch_dir_.clear();
+    throw std::runtime_error("MUSIC has no scratch directory.");
+  }
 }
 
 void MpiMusic::EvolveHydro() {
@@ -184,14 +215,17 @@ void MpiMusic::EvolveHydro() {
     double z_max = ini->GetZMax();
     int nz = ini->GetZSize();
     double tau0 = pre_eq_ptr->GetPreequilibriumEndTime();
+    // MUSIC takes the component vectors of the field by reference
+    TmunuField &tmunu = pre_eq_ptr->GetTmunuField();
     music_hydro_ptr->initialize_hydro_from_jetscape_preequilibrium_vectors(
-        tau0,
-        dx, dz, z_max, nz, pre_eq_ptr->e_, pre_eq_ptr->P_,
-        pre_eq_ptr->utau_, pre_eq_ptr->ux_, pre_eq_ptr->uy_, pre_eq_ptr->ueta_,
-        pre_eq_ptr->pi00_, pre_eq_ptr->pi01_, pre_eq_ptr->pi02_,
-        pre_eq_ptr->pi03_, pre_eq_ptr->pi11_, pre_eq_ptr->pi12_,
-        pre_eq_ptr->pi13_, pre_eq_ptr->pi22_, pre_eq_ptr->pi23_,
-        pre_eq_ptr->pi33_, pre_eq_ptr->bulk_Pi_);
+        tau0, dx, dz, z_max, nz, tmunu[TmunuField::E], tmunu[TmunuField::P],
+        tmunu[TmunuField::UTAU], tmunu[TmunuField::UX], tmunu[TmunuField::UY],
+        tmunu[TmunuField::UETA], tmunu[TmunuField::PI00],
+        tmunu[TmunuField::PI01], tmunu[TmunuField::PI02],
+        tmunu[TmunuField::PI03], tmunu[TmunuField::PI11],
+        tmunu[TmunuField::PI12], tmunu[TmunuField::PI13],
+        tmunu[TmunuField::PI22], tmunu[TmunuField::PI23],
+        tmunu[TmunuField::PI33], tmunu[TmunuField::BULK_PI]);
     JSINFO << "initial density profile dx = " << dx << " fm";
   }
 
@@ -241,6 +275,14 @@ void MpiMusic::EvolveHydro() {
       PassHydroEvolutionHistoryToFramework();
       JSINFO << "number of fluid cells received by the JETSCAPE: "
              << bulk_info.data.size();
+    } else if (flag_store_evo_with_sources == 1) {
+      // keep the pass with jet source terms as this module's own history;
+      // the preEq cells were handed over by the first pass already, so
+      // this history starts at the hydro tau0
+      clear_up_evolution_data();
+      PassHydroEvolutionHistoryToFramework(false);
+      JSINFO << "number of fluid cells with source terms received by "
+             << "the JETSCAPE: " << bulk_info.data.size();
     }
     music_hydro_ptr->clear_hydro_info_from_memory();
   }
@@ -256,10 +298,14 @@ void MpiMusic::EvolveHydro() {
     //music_hydro_ptr->clear_hydro_info_from_memory();
 
     // add hydro_id to the hydro evolution filename
-    std::ostringstream system_command;
-    system_command << "mv evolution_all_xyeta.dat "
-                   << "evolution_all_xyeta_" << GetId() << ".dat";
-    system(system_command.str().c_str());
+    std::error_code ec;
+    std::filesystem::rename("evolution_all_xyeta.dat",
+                            scratch_dir_ /
+                                ("evolution_all_xyeta_" + GetId() + ".dat"),
+                            ec);
+    if (ec) {
+      JSWARN << "Cannot rename evolution_all_xyeta.dat: " << ec.message();
+    }
 
     //std::vector<SurfaceCellInfo> surface_cells;
     //if (freezeout_temperature > 0.0) {
@@ -275,31 +321,51 @@ void MpiMusic::EvolveHydro() {
   }
 
   if (hydro_status == FINISHED && doCooperFrye == 1) {
+    // MUSIC reads its surface from surface.dat in the working directory
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    fs::path link = "surface.dat";
+    fs::remove(link, ec);
+    fs::create_symlink(surface_file_, link, ec);
+    if (ec) {
+      JSWARN << "Cannot link " << link << " to " << surface_file_ << ": "
+             << ec.message();
+    }
     music_hydro_ptr->run_Cooper_Frye();
+    fs::remove(link, ec);
   }
 }
 
+bool MpiMusic::IsHydroEvolutionCacheable() const {
+  // only a pass without jet source terms whose results all live in memory
+  return (flag_output_evo_to_memory == 1 && flag_surface_in_memory == 1 &&
+          doCooperFrye == 0 && weak_ptr_is_uninitialized(liquefier_ptr));
+}
+
 void MpiMusic::collect_freeze_out_surface() {
-  system("rm surface.dat 2> /dev/null");
-
-  std::ostringstream surface_filename;
-  surface_filename << "surface_" << GetId() << ".dat";
-
-  std::ostringstream system_command;
-  system_command << "rm " << surface_filename.str() << " 2> /dev/null";
-  system(system_command.str().c_str());
-  system_command.str("");
-  system_command.clear();
-  system_command << "cat surface_eps* >> " << surface_filename.str();
-  system(system_command.str().c_str());
-  system_command.str("");
-  system_command.clear();
-
-  system_command << "ln -s " << surface_filename.str() << " surface.dat";
-  system(system_command.str().c_str());
-  system_command.str("");
-  system_command.clear();
-  system("rm surface_eps* 2> /dev/null");
+  namespace fs = std::filesystem;
+  std::error_code ec;
+
+  // MUSIC writes the surface in pieces, surface_eps*, to the working
+  // directory; they are removed as soon as they are collected
+  std::vector<fs::path> pieces;
+  for (auto &entry : fs::directory_iterator(".", ec)) {
+    if (entry.path().filename().string().rfind("surface_eps", 0) == 0)
+      pieces.push_back(entry.path());
+  }
+  std::sort(pieces.begin(), pieces.end());
+
+  surface_file_ = scratch_dir_ / ("surface_" + GetId() + ".dat");
+  std::ofstream surface(surface_file_, std::ios::binary | std::ios::trunc);
+  for (auto &piece : pieces) {
+    std::ifstream in(piece, std::ios::binary);
+    std::copy(std::istreambuf_iterator<char>(in),
+              std::istreambuf_iterator<char>(),
+              std::ostreambuf_iterator<char>(surface));
+    in.close();
+    fs::remove(piece, ec);
+  }
+  surface.close();
 }
 
 
@@ -311,7 +377,7 @@ void MpiMusic::SetPreEqGridInfo() {
 }
 
 
-void MpiMusic::SetHydroGridInfo() {
+void MpiMusic::SetHydroGridInfo(bool with_pre_eq) {
   bulk_info.neta = music_hydro_ptr->get_neta();
   bulk_info.nx = music_hydro_ptr->get_nx();
   bulk_info.ny = music_hydro_ptr->get_nx();
@@ -324,7 +390,7 @@ void MpiMusic::SetHydroGridInfo() {
 
   bulk_info.boost_invariant = music_hydro_ptr->is_boost_invariant();
 
-  if (pre_eq_ptr == nullptr) {
+  if (pre_eq_ptr == nullptr || !with_pre_eq) {
     bulk_info.tau_min = music_hydro_ptr->get_hydro_tau0();
     bulk_info.dtau = music_hydro_ptr->get_hydro_dtau();
     bulk_info.ntau = music_hydro_ptr->get_ntau();
@@ -341,25 +407,34 @@ void MpiMusic::PassPreEqEvolutionHistoryToFramework() {
 
   SetPreEqGridInfo();
 
+  // fill the cells in place at the end of the history
+  std::size_t first_cell = bulk_info.data.size();
+  bulk_info.data.resize(first_cell + number_of_cells);
   for (int i = 0; i < number_of_cells; i++) {
-    std::unique_ptr<FluidCellInfo> fluid_cell_info_ptr(new FluidCellInfo);
-    pre_eq_ptr->get_fluid_cell_with_index(i, fluid_cell_info_ptr);
-    StoreHydroEvolutionHistory(fluid_cell_info_ptr);
+    pre_eq_ptr->get_fluid_cell_with_index(i, bulk_info.data[first_cell + i]);
   }
+  bulk_info.SparsifyFilledSlices();
   pre_eq_ptr->clear_evolution_data();
 }
 
 
-void MpiMusic::PassHydroEvolutionHistoryToFramework() {
+void MpiMusic::PassHydroEvolutionHistoryToFramework(bool with_pre_eq) {
   JSINFO << "Passing hydro evolution information to JETSCAPE ... ";
   auto number_of_cells = music_hydro_ptr->get_number_of_fluid_cells();
   JSINFO << "total number of MUSIC fluid cells: " << number_of_cells;
 
-  SetHydroGridInfo();
+  SetHydroGridInfo(with_pre_eq);
 
+  // fill the cells in place at the end of the history; a sparse history
+  // takes them over slice by slice
+  int cells_per_slice = bulk_info.GetTauSliceSize();
+  if (!bulk_info.is_sparse_filling()) {
+    bulk_info.data.reserve(bulk_info.data.size() + number_of_cells);
+  }
   fluidCell *fluidCell_ptr = new fluidCell;
   for (int i = 0; i < number_of_cells; i++) {
-    std::unique_ptr<FluidCellInfo> fluid_cell_info_ptr(new FluidCellInfo);
+    bulk_info.data.emplace_back();
+    FluidCellInfo *fluid_cell_info_ptr = &bulk_info.data.back();
     music_hydro_ptr->get_fluid_cell_with_index(i, fluidCell_ptr);
 
     fluid_cell_info_ptr->energy_density = fluidCell_ptr->ed;
@@ -379,7 +454,9 @@ void MpiMusic::PassHydroEvolutionHistoryToFramework() {
       }
     }
     fluid_cell_info_ptr->bulk_Pi = fluidCell_ptr->bulkPi;
-    StoreHydroEvolutionHistory(fluid_cell_info_ptr);
+    if ((i + 1) % cells_per_slice == 0) {
+      bulk_info.SparsifyFilledSlices();
+    }
   }
   delete fluidCell_ptr;
 }
@@ -434,7 +511,7 @@ void MpiMusic::GetHydroInfo_JETSCAPE(
 void MpiMusic::GetHydroInfo_MUSIC(
     Jetscape::real t, Jetscape::real x, Jetscape::real y, Jetscape::real z,
     std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr) {
-  fluid_cell_info_ptr = Jetscape::make_unique<FluidCellInfo>();
+  ResetFluidCellInfo(fluid_cell_info_ptr);
   fluidCell *fluidCell_ptr = new fluidCell;
   music_hydro_ptr->get_hydro_info(x, y, z, t, fluidCell_ptr);
   fluid_cell_info_ptr->energy_density = fluidCell_ptr->ed;
@@ -17,6 +17,7 @@
 #define MUSICWRAPPER_H
 
 #include <memory>
+#include <filesystem>
 
 #include "FluidDynamics.h"
 #include "music.h"
@@ -86,8 +87,11 @@ private:
   int flag_output_evo_to_file;
   int flag_output_evo_to_memory;
   int flag_surface_in_memory;
+  int flag_store_evo_with_sources; //!< keep the source-term pass in memory
   bool has_source_terms;
   std::shared_ptr<HydroSourceJETSCAPE> hydro_source_terms_ptr;
+  std::filesystem::path scratch_dir_; //!< per-task directory for the results
+  std::filesystem::path surface_file_; //!< collected surface, in scratch_dir_
 
   // Allows the registration of the module so that it is available to be
   // used by the Jetscape framework.
@@ -113,9 +117,9 @@ public:
                           std::unique_ptr<FluidCellInfo> &fluid_cell_info_ptr);
 
   void SetPreEqGridInfo();
-  void SetHydroGridInfo();
+  void SetHydroGridInfo(bool with_pre_eq = true);
   void PassPreEqEvolutionHistoryToFramework();
-  void PassHydroEvolutionHistoryToFramework();
+  void PassHydroEvolutionHistoryToFramework(bool with_pre_eq = true);
   void PassHydroSurfaceToFramework();
 
   void add_a_liquefier(std::shared_ptr<LiquefierBase> new_liqueifier) {
@@ -123,6 +127,10 @@ public:
     hydro_source_terms_ptr->add_a_liquefier(liquefier_ptr.lock());
   }
 
+  bool IsHydroEvolutionCacheable() const;
+
+  std::string GetSurfaceFile() const { return surface_file_.string(); }
+
   void GetHyperSurface(Jetscape::real T_cut,
                        SurfaceCellInfo *surface_list_ptr){};
   void collect_freeze_out_surface();
@@ -17,13 +17,16 @@
 #include "PGun.h"
 #include "JetScapeParticles.h"
 #include "Pythia8/Pythia.h"
+#include "JetScapePythiaStore.h"
 
 using namespace Jetscape;
 
 // Register the module with the base class
 RegisterJetScapeModule<PGun> PGun::reg("PGun");
 
-Pythia8::Pythia PGun::InternalHelperPythia("IntentionallyEmpty", false);
+Pythia8::Pythia PGun::InternalHelperPythia(JetScapePythiaStore::Settings(),
+                                           JetScapePythiaStore::ParticleData(),
+                                           false);
 
 PGun::PGun() : HardProcess() {
   fixed_pT = 0;
@@ -113,7 +116,7 @@ void PGun::Exec() {
   xLoc[1] = 0.0;
   xLoc[2] = 0.0;
 
-  auto ptn = make_shared<Parton>(0, parID, 0, pT, pseudorapidity, phi, p[0], xLoc);
+  auto ptn = MakeEventShared<Parton>(0, parID, 0, pT, pseudorapidity, phi, p[0], xLoc);
   ptn->set_color((parID > 0) ? 100 : 0);
   ptn->set_anti_color(((parID > 0) || (parID == 21)) ? 0 : 101);
   ptn->set_max_color(102);
@@ -21,6 +21,7 @@
 #include "HardProcess.h"
 #include "JetScapeLogger.h"
 #include "Pythia8/Pythia.h"
+#include "JetScapePythiaStore.h"
 
 using namespace Jetscape;
 
@@ -40,11 +41,21 @@ private:
   static RegisterJetScapeModule<PythiaGun> reg;
 
 public:
-  /** standard ctor
+  /** standard ctor, copies the Pythia databases that JetScapePythiaStore
+      read once instead of parsing the xml files again
+  */
+  PythiaGun()
+      : Pythia8::Pythia(JetScapePythiaStore::Settings(),
+                        JetScapePythiaStore::ParticleData(), false),
+        HardProcess() {
+    SetId("UninitializedPythiaGun");
+  }
+
+  /** ctor reading the databases from the xml files
       @param xmlDir: Note that the environment variable PYTHIA8DATA takes precedence! So don't use it.
       @param printBanner: Suppress starting blurb. Should be set to true in production, credit where it's due
   */
-  PythiaGun(string xmlDir = "DONTUSETHIS", bool printBanner = false)
+  PythiaGun(string xmlDir, bool printBanner = false)
       : Pythia8::Pythia(xmlDir, printBanner), HardProcess() {
     SetId("UninitializedPythiaGun");
   }
@@ -174,7 +174,9 @@ void TrentoInitial::InitTask() {
       "pseudorapidity max \n(eta grid from -max to +max)")(
       "eta-step",
       po::value<double>()->value_name("FLOAT")->default_value(0.5, "0.5"),
-      "pseudorapidity step size");
+      "pseudorapidity step size")(
+      "threads", po::value<int>()->value_name("INT")->default_value(1, "1"),
+      "threads filling the 3D density\n(0 = all hardware threads)");
 
   // Make a meta-group containing all the option groups except the main
   // positional options (don't want the auto-generated usage info for those).
@@ -229,6 +231,10 @@ void TrentoInitial::InitTask() {
   double skew = std::atof(longi_opts->Attribute("skew-coeff"));
   int skew_type = std::atof(longi_opts->Attribute("skew-type"));
   double J = std::atof(longi_opts->Attribute("jacobian"));
+  // threads for the 3D density, optional
+  int threads = 1;
+  if (longi_opts->Attribute("threads"))
+    threads = std::atoi(longi_opts->Attribute("threads"));
 
   std::string options1 =
       +" --random-seed " + std::to_string(random_seed) + " --cross-section " +
@@ -245,7 +251,8 @@ void TrentoInitial::InitTask() {
                          + " --xy-max " + std::to_string(xymax) +
                          " --xy-step " + std::to_string(dxy) + " --eta-max " +
                          std::to_string(etamax) + " --eta-step " +
-                         std::to_string(deta);
+                         std::to_string(deta) + " --threads " +
+                         std::to_string(threads);
   // Handle centrality table, not normzlized, default grid, 2D (fast) !!!
   std::string cmd_basic = proj + " " + targ + " 10000 " + options1;
   VarMap var_map_basic{};
@@ -16,12 +16,19 @@
 // Create e+e- -> qqbar processes with Pythia and return the two inital partons with set virtualities
 
 #include "epemGun.h"
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 
 #define MAGENTA "\033[35m"
 
 using namespace std;
 
+namespace {
+// Lower virtuality scale of the initial partons
+const double QS = 0.9;
+} // namespace
+
 // Register the module with the base class
 RegisterJetScapeModule<epemGun> epemGun::reg("epemGun");
 
@@ -143,13 +150,95 @@ void epemGun::InitTask() {
   // Initialize random number distribution
   ZeroOneDistribution = uniform_real_distribution<double>{0.0, 1.0};
 
+  //Reading vir_factor from xml for MATTER
+  vir_factor = GetXMLElementDouble({"Eloss", "Matter", "vir_factor"});
+
+  // Initial virtualities are sampled from tabulated Sudakov exponents,
+  // or by bisection on the direct integration if turned off
+  use_sudakov_table =
+      GetXMLElementInt({"Hard", "epemGun", "tabulated_sudakov"}) == 1;
+  n_sudakov_points =
+      GetXMLElementInt({"Hard", "epemGun", "sudakov_table_points"});
+  if (use_sudakov_table) {
+    BuildSudakovTables();
+  }
+}
+
+double epemGun::SudakovExponent(double mass, double t, double t_min) {
+  return (Cf / 2.0 / pi) * sud_val_QG_w_M(mass, (QS * QS / 2.), t_min, t,
+                                          0.5 * eCM);
+}
+
+void epemGun::BuildSudakovTables() {
+  sudakov_tables.clear();
+  n_sudakov_points = std::max(n_sudakov_points, 2);
+
+  for (int id = 1; id <= 5; id++) {
+    double mass = particleData.m0(id);
+    double t_max = (0.25 * eCM * eCM - mass * mass) * vir_factor;
+    double t_min = (QS * QS / 2.) *
+                   (1.0 + std::sqrt(1.0 + 2.0 * mass * mass / (QS * QS / 2.)));
+    if (t_max <= t_min) {
+      continue; // no sampling needed for this flavour
+    }
+
+    // Integrate interval by interval, the direct integration is the reference
+    SudakovTable &table = sudakov_tables[id];
+    table.log_t_min = std::log(t_min);
+    table.dlog_t = (std::log(t_max) - table.log_t_min) / (n_sudakov_points - 1);
+    table.exponent.assign(n_sudakov_points, 0.);
+    double t_low = t_min;
+    for (int i = 1; i < n_sudakov_points; i++) {
+      double t_high = i == n_sudakov_points - 1
+                          ? t_max
+                          : std::exp(table.log_t_min + i * table.dlog_t);
+      table.exponent[i] =
+          table.exponent[i - 1] + SudakovExponent(mass, t_high, t_low);
+      t_low = t_high;
+    }
+
+    // Validate the interpolation in between the grid points
+    double max_deviation = 0.;
+    for (int i = 0; i < 4; i++) {
+      double t = std::exp(table.log_t_min + (i * n_sudakov_points / 4 + 0.5) *
+                                                table.dlog_t);
+      double exact = std::exp(-SudakovExponent(mass, t, t_min));
+      max_deviation = std::max(
+          max_deviation, std::abs(std::exp(-table.Exponent(t)) - exact));
+    }
+    JSINFO << "epemGun: Sudakov table for pid " << id << " (m = " << mass
+           << " GeV) up to t = " << t_max << " GeV^2, max deviation = "
+           << max_deviation;
+  }
+}
+
+double epemGun::SudakovTable::Exponent(double t) const {
+  double x = (std::log(t) - log_t_min) / dlog_t;
+  if (x <= 0.) {
+    return 0.;
+  }
+  int i = std::min(static_cast<int>(x), static_cast<int>(exponent.size()) - 2);
+  double w = x - i;
+  return (1. - w) * exponent[i] + w * exponent[i + 1];
+}
+
+double epemGun::SudakovTable::Invert(double s) const {
+  // the exponent grows monotonically with t
+  auto it = std::upper_bound(exponent.begin(), exponent.end(), s);
+  if (it == exponent.begin()) {
+    return std::exp(log_t_min);
+  }
+  if (it == exponent.end()) {
+    return std::exp(log_t_min + (exponent.size() - 1) * dlog_t);
+  }
+  int i = it - exponent.begin() - 1;
+  double w = (s - exponent[i]) / (exponent[i + 1] - exponent[i]);
+  return std::exp(log_t_min + (i + w) * dlog_t);
 }
 
 void epemGun::Exec() {
   VERBOSE(1) << "Run Hard Process : " << GetId() << " ...";
   VERBOSE(8) << "Current Event #" << GetCurrentEvent();
-  //Reading vir_factor from xml for MATTER
-  double vir_factor = GetXMLElementDouble({"Eloss", "Matter", "vir_factor"});
   bool initial_virtuality_pT = GetXMLElementInt({"Eloss", "Matter", "initial_virtuality_pT"});
   if (initial_virtuality_pT) {
     JSINFO << "vir_factor set to use pT, will not affect epemGun";
@@ -240,7 +329,6 @@ void epemGun::Exec() {
     // Virtualities of the two partons
     double q1 = 0.;
     double q2 = 0.;
-    const double QS = 0.9;
 
     //Find initial virtuality one parton at a time
     for(int pass=0; pass<2; ++pass){
@@ -269,12 +357,24 @@ void epemGun::Exec() {
           diff = (ratio - random) / random;
         }
 
+        auto table = sudakov_tables.find(std::abs(p62[pass].id()));
+        bool tabulated = use_sudakov_table && table != sudakov_tables.end();
+
         if(max_vir >= (QS*QS / 2.) * (1.0 + std::sqrt(1.0 + 2.0 * mass * mass / (QS*QS / 2.)))){
           double g = (QS*QS / 2.) * (1.0 + std::sqrt(1.0 + 2.0 * mass * mass / (QS*QS / 2.)));
-          numer = exp(-1.0 * (Cf / 2.0 / pi) * sud_val_QG_w_M(mass,(QS*QS / 2.), g, max_vir, 0.5*eCM));
+          if (tabulated) {
+            numer = exp(-1.0 * table->second.Exponent(max_vir));
+          } else {
+            numer = exp(-1.0 * (Cf / 2.0 / pi) * sud_val_QG_w_M(mass,(QS*QS / 2.), g, max_vir, 0.5*eCM));
+          }
         }
 
         if (numer > random){tQ2 = min_vir;}
+        else if (tabulated) {
+          // Solve numer / Delta(t) = random directly:
+          // S(t) = S(max_vir) + log(random)
+          tQ2 = table->second.Invert(table->second.Exponent(max_vir) + std::log(random));
+        }
         else{
 
           double t_hi = max_vir;
@@ -350,7 +450,7 @@ void epemGun::Exec() {
 
     VERBOSE(7) << " at x=" << xLoc[1] << ", y=" << xLoc[2] << ", z=" << xLoc[3];
 
-    auto ptn = make_shared<Parton>(0, particle.id(), 0, particle.pT(), particle.eta(), particle.phi(), particle.e(), xLoc);
+    auto ptn = MakeEventShared<Parton>(0, particle.id(), 0, particle.pT(), particle.eta(), particle.phi(), particle.e(), xLoc);
     ptn->set_color(particle.col());
     ptn->set_anti_color(particle.acol());
     ptn->set_max_color(1000 * (np + 1));
@@ -21,6 +21,10 @@
 #include "HardProcess.h"
 #include "JetScapeLogger.h"
 #include "Pythia8/Pythia.h"
+#include "JetScapePythiaStore.h"
+
+#include <map>
+#include <vector>
 
 using namespace Jetscape;
 
@@ -39,15 +43,42 @@ private:
   double sud_z_QG_w_M(double M, double cg, double cg1, double E2);
   double alpha_s(double q2);
 
+  // Sudakov exponent (Cf/2pi) * int_{t_min}^{t} alpha_s sud_z_QG_w_M dh
+  // for one quark mass, on a grid uniform in log(t) from the minimal to the
+  // maximal initial virtuality. Filled once in InitTask.
+  struct SudakovTable {
+    double log_t_min, dlog_t;
+    std::vector<double> exponent;
+    double Exponent(double t) const;
+    double Invert(double s) const;
+  };
+  void BuildSudakovTables();
+  double SudakovExponent(double mass, double t, double t_min);
+
+  double vir_factor;
+  bool use_sudakov_table;
+  int n_sudakov_points;
+  std::map<int, SudakovTable> sudakov_tables; // by |pid|
+
 protected:
   std::uniform_real_distribution<double> ZeroOneDistribution;
 
 public:
-  /** standard ctor
+  /** standard ctor, copies the Pythia databases that JetScapePythiaStore
+      read once instead of parsing the xml files again
+  */
+  epemGun()
+      : Pythia8::Pythia(JetScapePythiaStore::Settings(),
+                        JetScapePythiaStore::ParticleData(), false),
+        HardProcess() {
+    SetId("UninitializedepemGun");
+  }
+
+  /** ctor reading the databases from the xml files
       @param xmlDir: Note that the environment variable PYTHIA8DATA takes precedence! So don't use it.
       @param printBanner: Suppress starting blurb. Should be set to true in production, credit where it's due
   */
-  epemGun(string xmlDir = "DONTUSETHIS", bool printBanner = false)
+  epemGun(string xmlDir, bool printBanner = false)
       : Pythia8::Pythia(xmlDir, printBanner), HardProcess() {
     SetId("UninitializedepemGun");
   }
@@ -18,6 +18,7 @@
 #include "JetScapeLogger.h"
 #include "JetScapeXML.h"
 #include <string>
+#include <algorithm>
 
 #include "tinyxml2.h"
 #include <iostream>
@@ -66,6 +67,19 @@ void AdSCFT::Init() {
   //Vac or Med
   in_vac = GetXMLElementDouble({"Eloss", "AdSCFT", "in_vac"});
   ;
+
+  //Multi-step updates in slowly varying cells (optional, off by default)
+  max_steps = GetXMLElementInt({"Eloss", "AdSCFT", "max_steps"}, false);
+  if (max_steps < 1)
+    max_steps = 1;
+  double tolerance =
+      GetXMLElementDouble({"Eloss", "AdSCFT", "step_tolerance"}, false);
+  if (tolerance > 0.)
+    step_tolerance = tolerance;
+  eloss_maxT = GetXMLElementDouble({"Eloss", "maxT"});
+  if (max_steps > 1)
+    JSINFO << "AdSCFT covers up to " << max_steps
+           << " steps per update, fluid tolerance = " << step_tolerance;
 }
 
 void AdSCFT::WriteTask(weak_ptr<JetScapeWriter> w) {
@@ -90,6 +104,16 @@ void AdSCFT::DoEnergyLoss(double deltaT, double time, double Q2,
       return;
     }
 
+    //Steps already covered by the next multi-step update
+    if (max_steps > 1 && pIn[i].has_user_info<AdSCFTUserInfo>() &&
+        pIn[i].user_info<AdSCFTUserInfo>().steps_left() > 0) {
+      AdSCFTUserInfo *info =
+          new AdSCFTUserInfo(pIn[i].user_info<AdSCFTUserInfo>());
+      info->_steps_left--;
+      pIn[i].set_user_info(info);
+      continue;
+    }
+
     JSDEBUG << " in AdS/CFT";
     JSDEBUG << " Parton Q2= " << pIn[i].t();
     JSDEBUG << " Parton Id= " << pIn[i].pid()
@@ -167,6 +191,31 @@ void AdSCFT::DoEnergyLoss(double deltaT, double time, double Q2,
       VERBOSE(8) << " DOING ADSCFT \n \n";
       VERBOSE(8) << " ************ \n \n";
 
+      //Energy (three-momentum) of parton as it entered this module for the first time
+      double ei = pmod;
+      double l_dist = 0., f_dist = 0.;
+      int span = 1;
+      if (pIn[i].has_user_info<AdSCFTUserInfo>()) {
+        const AdSCFTUserInfo &info = pIn[i].user_info<AdSCFTUserInfo>();
+        ei = info.part_ei();
+        l_dist = info.l_dist();
+        f_dist = info.f_dist();
+        span = info.span();
+        //Fluid over a multi-step interval: interpolated to the mean time of
+        //the cells single steps would have seen, i.e. the span steps after
+        //the last update
+        if (max_steps > 1 && span > 1 && info._temp >= 0.) {
+          double a = 0.5 * (span + 1.) / span;
+          temp = a * temp + (1. - a) * info._temp;
+          vx = a * vx + (1. - a) * info._vx;
+          vy = a * vy + (1. - a) * info._vy;
+          vz = a * vz + (1. - a) * info._vz;
+        }
+      } else {
+        pIn[i].set_user_info(new AdSCFTUserInfo(ei, f_dist, l_dist));
+      }
+      double stepT = span * deltaT;
+
       //Fluid quantities
       vector<double> v;
       v.push_back(vx), v.push_back(vy), v.push_back(vz), v.push_back(1.);
@@ -180,17 +229,6 @@ void AdSCFT::DoEnergyLoss(double deltaT, double time, double Q2,
       else
         CF = 1.; //Quark
 
-      //Energy (three-momentum) of parton as it entered this module for the first time
-      double ei = pmod;
-      double l_dist = 0., f_dist = 0.;
-      if (pIn[i].has_user_info<AdSCFTUserInfo>()) {
-        ei = pIn[i].user_info<AdSCFTUserInfo>().part_ei();
-        l_dist = pIn[i].user_info<AdSCFTUserInfo>().l_dist();
-        f_dist = pIn[i].user_info<AdSCFTUserInfo>().f_dist();
-      } else {
-        pIn[i].set_user_info(new AdSCFTUserInfo(ei, f_dist, l_dist));
-      }
-
       //JSDEBUG << " ei= " << ei;
       //JSDEBUG << " px= " << p[0] << " py= " << p[1] << " pz= " << p[2] << " en= " << p[3];
       //JSDEBUG << " x= " << x[0] << " y= " << x[1] << " z= " << x[2] << " t= " << x[3];
@@ -207,20 +245,24 @@ void AdSCFT::DoEnergyLoss(double deltaT, double time, double Q2,
       double vscalw = v[0] * w[0] + v[1] * w[1] + v[2] * w[2];
 
       //Distance travelled in LAB frame
-      l_dist += deltaT;
+      l_dist += stepT;
 
       //Distance travelled in FRF - accumulating steps from previous, different fluid cells
       double insqrt = w2 + lore * lore * (v2 - 2. * vscalw + vscalw * vscalw);
       if (insqrt <= 0.)
         insqrt = 0.;
-      f_dist += deltaT * std::sqrt(insqrt);
+      double f_step = stepT * std::sqrt(insqrt);
+      f_dist += f_step;
 
       //JSDEBUG << " l_dist= " << l_dist << " f_dist= " << f_dist;
       //Initial energy of the parton in the FRF
       double Efs = ei * lore * (1. - vscalw);
 
       double newEn = pmod;
-      if (temp >= 0.)
+      if (temp >= 0. && max_steps > 1)
+        newEn = pmod - DragIntegral(f_dist - f_step, f_step, stepT, Efs, temp,
+                                    CF);
+      else if (temp >= 0.)
         newEn = pmod - AdSCFT::Drag(f_dist, deltaT, Efs, temp, CF);
       if (newEn < 0.)
         newEn = pmod / 10000000.;
@@ -252,7 +294,22 @@ void AdSCFT::DoEnergyLoss(double deltaT, double time, double Q2,
       FourVector xVec;
       pOut.push_back(Parton(pLabel, Id, pStat, pVec, xVec));
       pOut[pOut.size() - 1].set_x(fx);
-      pOut.back().set_user_info(new AdSCFTUserInfo(ei, f_dist, l_dist));
+      AdSCFTUserInfo *info = new AdSCFTUserInfo(ei, f_dist, l_dist);
+      if (max_steps > 1) {
+        //Fluid at the end of this update is the start of the next one
+        info->_temp = check_fluid_info_ptr ? check_fluid_info_ptr->temperature
+                                           : 0.;
+        info->_vx = check_fluid_info_ptr ? check_fluid_info_ptr->vx : 0.;
+        info->_vy = check_fluid_info_ptr ? check_fluid_info_ptr->vy : 0.;
+        info->_vz = check_fluid_info_ptr ? check_fluid_info_ptr->vz : 0.;
+        info->_span = StepsAhead(x, w, deltaT, info->_temp, info->_vx,
+                                 info->_vy, info->_vz);
+        info->_steps_left = info->_span - 1;
+        info->_steps = span;
+        VERBOSE(7) << "AdSCFT update covered " << span
+                   << " steps, next one covers " << info->_span;
+      }
+      pOut.back().set_user_info(info);
 
       //Copy variables needed in case parton returns to MATTER in future steps
       double velocity_jet[4];
@@ -271,6 +328,14 @@ void AdSCFT::DoEnergyLoss(double deltaT, double time, double Q2,
       pOut.push_back(Parton(0, 21, -13, pVecM, xVec));
       pOut[pOut.size() - 1].set_x(fx);
 
+    } else if (max_steps > 1 && pIn[i].has_user_info<AdSCFTUserInfo>() &&
+               pIn[i].user_info<AdSCFTUserInfo>().span() > 1) {
+      //Interval ended outside the AdS/CFT regime, start afresh next time
+      AdSCFTUserInfo *info =
+          new AdSCFTUserInfo(pIn[i].user_info<AdSCFTUserInfo>());
+      info->_span = 1;
+      info->_temp = -1.;
+      pIn[i].set_user_info(info);
     } //End if do-eloss
 
   } //End pIn loop
@@ -297,4 +362,57 @@ double AdSCFT::Drag(double f_dist, double deltaT, double Efs, double temp,
     return 0.;
 }
 
+double AdSCFT::DragIntegral(double f_dist, double df, double deltaT,
+                            double Efs, double temp, double CF) {
+  if (kappa == 0.)
+    return 0.;
+  //Parton at rest in the fluid: f_dist does not grow, Drag is constant
+  if (df <= rounding_error)
+    return Drag(f_dist + df, deltaT, Efs, temp, CF);
+
+  double tstop = 0.2 * std::pow(Efs, 1. / 3.) /
+                 (2. * std::pow(temp, 4. / 3.) * kappa) / CF;
+  if (f_dist + df >= tstop)
+    return 100000.;
+
+  //Drag per lab distance is dE/dt = 4 Efs/pi f^2/(tstop^2 sqrt(tstop^2-f^2))
+  //with f growing at df/deltaT; its antiderivative in f is G/tstop^2 with
+  //G(f) = (tstop^2 asin(f/tstop) - f sqrt(tstop^2-f^2))/2
+  auto G = [tstop](double f) {
+    return 0.5 * (tstop * tstop * std::asin(f / tstop) -
+                  f * std::sqrt(tstop * tstop - f * f));
+  };
+  return Efs * 4. / (3.141592) * (deltaT / df) *
+         (G(f_dist + df) - G(f_dist)) / (tstop * tstop);
+}
+
+int AdSCFT::StepsAhead(const double *x, const vector<double> &w,
+                       double deltaT, double temp, double vx, double vy,
+                       double vz) {
+  //Probe the fluid where the parton will be after n steps, halving n until
+  //the cell there differs from the current one by less than the tolerance
+  int n = max_steps;
+  if (eloss_maxT > 0.)
+    n = std::min(n, int((eloss_maxT - x[3]) / deltaT + rounding_error));
+  for (; n > 1; n /= 2) {
+    double t = x[3] + n * deltaT;
+    double xn = x[0] + n * deltaT * w[0];
+    double yn = x[1] + n * deltaT * w[1];
+    double zn = x[2] + n * deltaT * w[2];
+    if (t * t - zn * zn < tStart * tStart)
+      continue;
+    std::unique_ptr<FluidCellInfo> ahead;
+    GetHydroCellSignal(t, xn, yn, zn, ahead);
+    if (!ahead)
+      return 1;
+    double dv = std::max({std::abs(ahead->vx - vx), std::abs(ahead->vy - vy),
+                          std::abs(ahead->vz - vz)});
+    if (ahead->temperature >= T0 &&
+        std::abs(ahead->temperature - temp) <= step_tolerance * temp &&
+        dv <= step_tolerance)
+      return n;
+  }
+  return 1;
+}
+
 void AdSCFT::Clear() {}
@@ -30,6 +30,15 @@ public:
   double _part_ei;
   double _f_dist;
   double _l_dist;
+
+  // Multi-step mode: fluid cell at the last update, the number of framework
+  // steps the next update covers, how many of them are still to be skipped,
+  // and how many steps the last update covered
+  double _temp = -1., _vx = 0., _vy = 0., _vz = 0.;
+  int _span = 1, _steps_left = 0, _steps = 1;
+  int span() const { return _span; }
+  int steps_left() const { return _steps_left; }
+  int steps() const { return _steps; }
   ~AdSCFTUserInfo(){};
 };
 
@@ -44,6 +53,10 @@ public:
   void DoEnergyLoss(double deltaT, double time, double Q2, vector<Parton> &pIn,
                     vector<Parton> &pOut);
   double Drag(double f_dist, double deltaT, double Efs, double temp, double CF);
+  /// Energy lost while the FRF distance grows from f_dist to f_dist + df at
+  /// a constant rate, i.e. the exact integral of Drag over the interval
+  double DragIntegral(double f_dist, double df, double deltaT, double Efs,
+                      double temp, double CF);
   void WriteTask(weak_ptr<JetScapeWriter> w);
 
 private:
@@ -53,6 +66,17 @@ private:
   bool in_vac;         //In vacuum or not switch
   double kappa;        //Drag strength parameter
 
+  // Multi-step mode (max_steps > 1): one update covers up to max_steps
+  // framework steps as long as the fluid changes by less than step_tolerance
+  int max_steps = 1;
+  double step_tolerance = 0.02;
+  double eloss_maxT = 0.; //End of the eloss evolution, not to be passed
+
+  /// Number of steps (<= max_steps) over which the fluid cell at x (x,y,z,t)
+  /// stays within step_tolerance along the direction w
+  int StepsAhead(const double *x, const vector<double> &w, double deltaT,
+                 double temp, double vx, double vy, double vz);
+
   // Allows the registration of the module so that it is available to be used by the Jetscape framework.
   static RegisterJetScapeModule<AdSCFT> reg;
 };
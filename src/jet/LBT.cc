@@ -26,6 +26,7 @@
 
 #include "FluidDynamics.h"
 #include "LBTMutex.h"
+#include "JetScapeMemoryPlacement.h"
 #define MAGENTA "\033[35m"
 
 using namespace Jetscape;
@@ -119,15 +120,28 @@ void LBT::Init() {
 
   Kprimary = GetXMLElementInt({"Eloss", "Lbt", "only_leading"});
   run_alphas = GetXMLElementInt({"Eloss", "Lbt", "run_alphas"});
+  event_driven = GetXMLElementInt({"Eloss", "Lbt", "event_driven"}, false);
+  event_driven_cell =
+      GetXMLElementDouble({"Eloss", "Lbt", "event_driven_cell"}, false);
   Q00 = GetXMLElementDouble({"Eloss", "Lbt", "Q0"});
   fixAlphas = GetXMLElementDouble({"Eloss", "Lbt", "alphas"});
   hydro_Tc = GetXMLElementDouble({"Eloss", "Lbt", "hydro_Tc"});
   tStart = GetXMLElementDouble({"Eloss", "tStart"});
   JSINFO << MAGENTA << "LBT parameters -- in_med: " << vacORmed
          << " Q0: " << Q00 << "  only_leading: " << Kprimary
-         << "  alpha_s: " << fixAlphas << "  hydro_Tc: " << hydro_Tc<<", tStart="<<tStart;
+         << "  alpha_s: " << fixAlphas << "  hydro_Tc: " << hydro_Tc<<", tStart="<<tStart
+         << "  event_driven: " << event_driven
+         << "  event_driven_cell: " << event_driven_cell;
 
   if (!flag_init) {
+    // large read-mostly tables: place them before they are first written
+    for (auto table : {dNg_over_dt_c, dNg_over_dt_q, dNg_over_dt_g,
+                       max_dNgfnc_c, max_dNgfnc_q, max_dNgfnc_g}) {
+      JetScapeMemoryPlacement::Place(table, sizeof(dNg_over_dt_c));
+    }
+    for (auto table : {distFncB, distFncF, distMaxB, distMaxF}) {
+      JetScapeMemoryPlacement::Place(table, sizeof(distFncB));
+    }
     read_tables(); // initialize various tables
     flag_init = true;
   }
@@ -235,7 +249,16 @@ void LBT::DoEnergyLoss(double deltaT, double time, double Q2,
       V[1][j] = Vfrozen[1][j];
       V[2][j] = Vfrozen[2][j];
       V[3][j] = Vfrozen[3][j];
-      V[0][j] = -log(1.0 - ZeroOneDistribution(*GetMt19937Generator()));
+
+      // optical depth left to the next interaction, carried between steps
+      // in event-driven mode, otherwise sampled afresh
+      double depth_left = -1.0;
+      if (event_driven == 1 && pIn[i].has_user_info<LBTUserInfo>())
+        depth_left = pIn[i].user_info<LBTUserInfo>().depth_left();
+      if (depth_left >= 0.0)
+        V[0][j] = depth_left;
+      else
+        V[0][j] = -log(1.0 - ZeroOneDistribution(*GetMt19937Generator()));
 
       for (int k = 0; k <= 3; k++)
         Prad[k][j] = P[k][j];
@@ -329,6 +352,13 @@ void LBT::DoEnergyLoss(double deltaT, double time, double Q2,
     //          }
 
     //if(alphas>epsilon && vacORmed!=0) {
+    // event-driven: between interactions, a parton that stays in the cell
+    // of its last medium evaluation streams without evaluating it again
+    if (event_driven == 1 && vacORmed != 0 && par_status != -1 &&
+        StreamInCachedMedium(pIn[i], deltaT, systemTime, pOut))
+      continue;
+
+    step_cache.valid = false;
     if (vacORmed != 0) { // for JETSCAPE, won't change parton if it's in vacuum
       flagScatter = 0;
       LBT0(
@@ -403,7 +433,13 @@ void LBT::DoEnergyLoss(double deltaT, double time, double Q2,
 
         pOut.push_back(Parton(0, KATT1[j], out_stat, tempP, tempX));
         // remember to put Tint_lrf infomation back to JETSCAPE
-        pOut.back().set_user_info(new LBTUserInfo(Tint_lrf[j]));
+        if (event_driven == 1) {
+          pOut.back().set_user_info(new LBTUserInfo(
+              Tint_lrf[j], V[0][j],
+              j == 1 ? step_cache : LBTMediumCache()));
+        } else {
+          pOut.back().set_user_info(new LBTUserInfo(Tint_lrf[j]));
+        }
 
         int iout = pOut.size() - 1;
         pOut[iout].set_jet_v(velocity_jet); // use initial jet velocity
@@ -475,6 +511,52 @@ void LBT::DoEnergyLoss(double deltaT, double time, double Q2,
   }
 }
 
+bool LBT::StreamInCachedMedium(Parton &pIn, double deltaT, double time,
+                               vector<Parton> &pOut) {
+  if (!pIn.has_user_info<LBTUserInfo>())
+    return false;
+  const LBTUserInfo &info = pIn.user_info<LBTUserInfo>();
+  const LBTMediumCache &medium = info.medium();
+  double depth_left = info.depth_left() - medium.depth_per_step;
+  if (!medium.valid || depth_left <= 0.0)
+    return false; // the parton interacts in this step, LBT0 handles it
+
+  // the straight line LBT0 would move the parton along
+  double mass = amss;
+  if (std::abs(pIn.pid()) == 4 || std::abs(pIn.pid()) == 5)
+    mass = pIn.restmass();
+  double p[4] = {0.0, pIn.p(1), pIn.p(2), pIn.p(3)};
+  p[0] = sqrt(p[1] * p[1] + p[2] * p[2] + p[3] * p[3] + mass * mass);
+  if (p[0] < cutOut)
+    return false;
+  const FourVector &x_in = pIn.x_in();
+  double x[4] = {time, x_in.x() + (time - x_in.t()) * p[1] / p[0],
+                 x_in.y() + (time - x_in.t()) * p[2] / p[0],
+                 x_in.z() + (time - x_in.t()) * p[3] / p[0]};
+
+  double tint = info.lrf_T_tot() + medium.tint_per_step;
+  int rad_bin = medium.rad_time_bin >= 0 ? RadiationTimeBin(tint) : -1;
+  if (!medium.Covers(x, event_driven_cell, deltaT, rad_bin))
+    return false;
+
+  TakeResponsibilityFor(pIn);
+
+  double virtuality = pIn.e() * pIn.e() - p[0] * p[0];
+  if (virtuality < 0.0)
+    virtuality = 0.0;
+  double tempP[4] = {sqrt(p[0] * p[0] + virtuality), p[1], p[2], p[3]};
+  int out_stat = pIn.pstat() == 1 ? 1 : 0; // recoil or jet parton
+  pOut.push_back(Parton(0, pIn.pid(), out_stat, tempP, x));
+  pOut.back().set_user_info(new LBTUserInfo(tint, depth_left, medium));
+
+  double velocity_jet[4] = {1.0, pIn.jet_v().x(), pIn.jet_v().y(),
+                            pIn.jet_v().z()};
+  pOut.back().set_jet_v(velocity_jet);
+  pOut.back().set_mean_form_time();
+  pOut.back().set_form_time(pOut.back().mean_form_time());
+  return true;
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // This is the key function of LBT
@@ -952,6 +1034,8 @@ void LBT::LBT0(int &n, double &ti) {
             dt *
             flowFactor; // must be put here, flowFactor will be changed below
 
+        double tint_before = Tint_lrf[i];
+
         // increae time accumulation from the production point of the parton
         for (double tLoc = lrf_rStart[0]; tLoc < ti + rounding_error;
              tLoc = tLoc + dt) {
@@ -969,6 +1053,10 @@ void LBT::LBT0(int &n, double &ti) {
           else
             dtLoc = ti - tLoc;
 
+          // the last sub-step ends at ti and adds nothing
+          if (event_driven == 1 && dtLoc < rounding_error)
+            continue;
+
           std::unique_ptr<FluidCellInfo> check_fluid_info_ptr;
 
           SpatialRapidity = 0.5 * std::log((tLoc + zLoc) / (tLoc - zLoc));
@@ -1036,10 +1124,11 @@ void LBT::LBT0(int &n, double &ti) {
 
           //??????@@@
           //////////////////
-          V[0][i] = V[0][i] - fraction * dt * RTE / 0.1970 *
-                                  sqrt(pow(P[1][i], 2) + pow(P[2][i], 2) +
-                                       pow(P[3][i], 2)) /
-                                  P[0][i];
+          if (event_driven == 0)
+            V[0][i] = V[0][i] - fraction * dt * RTE / 0.1970 *
+                                    sqrt(pow(P[1][i], 2) + pow(P[2][i], 2) +
+                                         pow(P[3][i], 2)) /
+                                    P[0][i];
           probCol = fraction * dt_lrf * RTE / 0.1970;
         }
         ////...........................................tau-eta coordinates
@@ -1059,14 +1148,38 @@ void LBT::LBT0(int &n, double &ti) {
         } else {
             probCol = probCol * KPfactor * KTfactor * preKT;
         }
+        // integrated interaction rate over this step: probTot = 1 - exp(-depth)
+        double depth = (KINT0 == 2 ? 0.0 : probCol) +
+                       (probRad > 0.0 ? radng[i] : 0.0);
         probCol = (1.0 - exp(-probCol)) *
                   (1.0 - probRad); // probability of pure elastic scattering
         if (KINT0 == 2)
           probCol = 0.0;
         probTot = probCol + probRad;
 
-        if (ZeroOneDistribution(*GetMt19937Generator()) <
-            probTot) { // !Yes, collision! Either elastic or inelastic.
+        // Event-driven: V[0] holds the optical depth sampled at the last
+        // interaction, and the parton streams until the rate has used it up.
+        // Same distribution as one draw against probTot per step.
+        bool collide;
+        if (event_driven == 1) {
+          V[0][i] = V[0][i] - depth;
+          collide = V[0][i] <= 0.0;
+          if (i == 1 && !collide) {
+            // keep this step's medium for the next steps in the same cell
+            double x[4] = {tcar, xcar, ycar, zcar};
+            step_cache.valid = true;
+            LBTMediumCache::Cell(x, event_driven_cell, step_cache.cell);
+            step_cache.dt = dt;
+            step_cache.depth_per_step = depth;
+            step_cache.tint_per_step = Tint_lrf[i] - tint_before;
+            step_cache.rad_time_bin =
+                probRad > 0.0 ? RadiationTimeBin(Tdiff) : -1;
+          }
+        } else {
+          collide = ZeroOneDistribution(*GetMt19937Generator()) < probTot;
+        }
+
+        if (collide) { // !Yes, collision! Either elastic or inelastic.
 
           flagScatter = 1;
 
@@ -3823,6 +3936,15 @@ int LBT::KPoisson(double alambda) {
   return KKPoisson;
 }
 
+int LBT::RadiationTimeBin(double time_gluon) const {
+  // time row of the radiation tables that nHQgluon reads
+  if (time_gluon > t_max)
+    time_gluon = t_max;
+  if (time_gluon < t_max_1)
+    return (int)(time_gluon / delta_tg_1 + 0.5) + 1;
+  return (int)((time_gluon - t_max_1) / delta_tg_2 + 0.5) + t_gn_1 + 1;
+}
+
 double LBT::nHQgluon(int parID, double dtLRF, double &time_gluon,
                      double &temp_med, double &HQenergy, double &max_Ng) {
   // gluon radiation probability for heavy quark
@@ -3857,11 +3979,7 @@ double LBT::nHQgluon(int parID, double dtLRF, double &time_gluon,
     temp_med = temp_min;
   }
 
-  if(time_gluon < t_max_1) {
-      time_num = (int)(time_gluon / delta_tg_1 + 0.5) + 1;
-  } else {
-      time_num = (int)((time_gluon - t_max_1) / delta_tg_2 + 0.5) + t_gn_1 + 1;
-  }
+  time_num = RadiationTimeBin(time_gluon);
   //  temp_num=(int)((temp_med-temp_min)/delta_temp+0.5);
   //  HQenergy_num=(int)(HQenergy/delta_HQener+0.5); // use linear interpolation instead of finding nearest point for E and T dimensions
   temp_num = (int)((temp_med - temp_min) / delta_temp);
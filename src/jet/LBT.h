@@ -17,6 +17,7 @@
 #define LBT_H
 
 #include "JetEnergyLossModule.h"
+#include <cmath>
 #include <iostream>
 #include <string>
 #include <sstream>
@@ -24,12 +25,56 @@
 
 using namespace Jetscape;
 
+/** Medium seen by a parton in event-driven mode (<event_driven>1</event_driven>).
+ *  It is evaluated in full at one step and reused for the following steps
+ *  until the parton interacts or leaves the cell, a box of edge
+ *  <event_driven_cell> fm in (t, x, y, z), in which it was evaluated.
+ */
+struct LBTMediumCache {
+  bool valid = false;
+  long cell[4] = {0, 0, 0, 0};
+  double dt = 0.0;             //!< step length it was evaluated for [fm]
+  double depth_per_step = 0.0; //!< elastic plus radiative optical depth
+  double tint_per_step = 0.0;  //!< increase of Tint_lrf
+  int rad_time_bin = -1;       //!< bin of the radiation table, -1: no radiation
+
+  static void Cell(const double x[4], double cell_size, long cell[4]) {
+    for (int k = 0; k <= 3; k++)
+      cell[k] = static_cast<long>(std::floor(x[k] / cell_size));
+  }
+
+  /** @return Whether a step of length step ending at x, with radiation
+   *  table bin rad_bin, sees the same medium as the cached one.
+   */
+  bool Covers(const double x[4], double cell_size, double step,
+              int rad_bin) const {
+    if (!valid || cell_size <= 0.0 || std::abs(step - dt) > 1e-9)
+      return false;
+    if (rad_time_bin >= 0 && rad_bin != rad_time_bin)
+      return false;
+    long here[4];
+    Cell(x, cell_size, here);
+    for (int k = 0; k <= 3; k++)
+      if (here[k] != cell[k])
+        return false;
+    return true;
+  }
+};
+
 //class LBTUserInfo: public Parton::PseudoJet::UserInfoBase {
 class LBTUserInfo : public fjcore::PseudoJet::UserInfoBase {
 public:
-  LBTUserInfo(double ttt) : _lrf_T_tot(ttt){};
+  LBTUserInfo(double ttt, double depth = -1.0,
+              const LBTMediumCache &medium = LBTMediumCache())
+      : _lrf_T_tot(ttt), _depth_left(depth), _medium(medium){};
   double lrf_T_tot() const { return _lrf_T_tot; }
+  // remaining optical depth to the next interaction (event_driven), <0: none
+  double depth_left() const { return _depth_left; }
+  // medium of the last full evaluation (event_driven)
+  const LBTMediumCache &medium() const { return _medium; }
   double _lrf_T_tot;
+  double _depth_left;
+  LBTMediumCache _medium;
 };
 
 //variables for unit test
@@ -98,6 +143,11 @@ private:
   int fixMomentum = 0;
   int fixPosition = 1;
   int run_alphas = 1;
+  int event_driven =
+      0; // 1: interact when the integrated rate uses up a sampled optical depth
+  double event_driven_cell =
+      0.3; // [fm] cell in which event_driven reuses the medium, <=0: never
+  LBTMediumCache step_cache; // medium of the current step, see LBT0
   int flagJetX =
       0; // 0: do nothing; 1: keep momentum but reset jet position within LBT
   int Kjet = 21; //initial flavor of the jet parton
@@ -386,6 +436,9 @@ private:
   double alphasHQ(double kTFnc, double tempFnc);
   double nHQgluon(int parID, double dtLRF, double &time_gluon, double &temp_med,
                   double &HQenergy, double &max_Ng);
+  int RadiationTimeBin(double time_gluon) const;
+  bool StreamInCachedMedium(Parton &pIn, double deltaT, double time,
+                            vector<Parton> &pOut);
 
   void read_xyMC(int &numXY);
   void jetInitialize(int numXY);
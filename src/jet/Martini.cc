@@ -23,6 +23,7 @@
 
 #include "FluidDynamics.h"
 #include "MartiniMutex.h"
+#include "JetScapeMemoryPlacement.h"
 #define hbarc 0.197327053
 
 #define MAGENTA "\033[35m"
@@ -95,6 +96,13 @@ void Martini::Init() {
   readRadiativeRate(&dat, &Gam);
   readElasticRateOmega();
   readElasticRateQ();
+
+  // the elastic rates are shared by all clones
+  JetScapeMemoryPlacement::Place(*dGamma_qq);
+  JetScapeMemoryPlacement::Place(*dGamma_qg);
+  JetScapeMemoryPlacement::Place(*dGamma_qq_q);
+  JetScapeMemoryPlacement::Place(*dGamma_qg_q);
+  JetScapeMemoryPlacement::Place(&Gam, sizeof(Gam));
 }
 
 void Martini::DoEnergyLoss(double deltaT, double Time, double Q2,
@@ -16,7 +16,7 @@
 #include "Matter.h"
 #include "JetScapeLogger.h"
 #include "JetScapeParticles.h"
-#include "Pythia8/Pythia.h"
+#include "JetScapePythiaStore.h"
 
 #include <string>
 
@@ -35,8 +35,6 @@ const double QS = 0.9;
 // Register the module with the base class
 RegisterJetScapeModule<Matter> Matter::reg("Matter");
 
-static Pythia8::Pythia PythiaFunction("IntentionallyEmpty", false);
-
 bool Matter::flag_init = 0;
 
 double Matter::RHQ[60][20] = {{0.0}};    //total scattering rate for heavy quark
@@ -953,7 +951,7 @@ void Matter::DoEnergyLoss(double deltaT, double time, double Q2,
               P_z_gg_int(z_low, z_hi, zeta, t_used, tau_form, pIn[i].nu());
           double val2 =
               nf * P_z_qq_int(z_low, z_hi, zeta, t_used, tau_form, pIn[i].nu());
-          double M = PythiaFunction.particleData.m0(cid);
+          double M = JetScapePythiaStore::ParticleData().m0(cid);
           z_low = (QS * QS + 2.0 * M * M) / t_used / 2.0;
           z_hi = 1.0 - z_low;
           double val3 = 0.0;
@@ -963,7 +961,7 @@ void Matter::DoEnergyLoss(double deltaT, double time, double Q2,
           if (t_used < (QS * QS + 2.0 * M * M))
             val3 = 0.0;
 
-          M = PythiaFunction.particleData.m0(bid);
+          M = JetScapePythiaStore::ParticleData().m0(bid);
           z_low = (QS * QS + 2.0 * M * M) / t_used / 2.0;
           z_hi = 1.0 - z_low;
           double val4 = 0.0;
@@ -1176,7 +1174,7 @@ void Matter::DoEnergyLoss(double deltaT, double time, double Q2,
           // use pIn information to sample z above, but use new_parent to calculate daughter partons below
 
           if (std::abs(pid_a) == 4 || std::abs(pid_a) == 5) {
-            double M = PythiaFunction.particleData.m0(pid_a);
+            double M = JetScapePythiaStore::ParticleData().m0(pid_a);
             if (QS * QS * (1.0 + std::sqrt(1.0 + 4.0 * M * M / QS / QS)) / 2.0 <
                 z * z * new_parent_t) {
               tQd1 = generate_vac_t_w_M(
@@ -1218,7 +1216,7 @@ void Matter::DoEnergyLoss(double deltaT, double time, double Q2,
             iSplit_b = 1;
 
           if (std::abs(pid_b) == 4 || std::abs(pid_b) == 5) {
-            double M = PythiaFunction.particleData.m0(pid_b);
+            double M = JetScapePythiaStore::ParticleData().m0(pid_b);
 
             if (QS * QS * (1.0 + std::sqrt(1.0 + 4.0 * M * M / QS / QS)) / 2.0 <
                 (1.0 - z) * (1.0 - z) * new_parent_t) {
@@ -1275,7 +1273,7 @@ void Matter::DoEnergyLoss(double deltaT, double time, double Q2,
                      (iSplit > 3)) // gluon decay into heavy quark anti-quark
           {
 
-            double M = PythiaFunction.particleData.m0(pid_a);
+            double M = JetScapePythiaStore::ParticleData().m0(pid_a);
 
             l_perp2 = new_parent_t * z * (1.0 - z) - tQd2 * z -
                       tQd1 * (1.0 - z) - M * M;
@@ -1358,7 +1356,7 @@ void Matter::DoEnergyLoss(double deltaT, double time, double Q2,
         double M = 0.0;
 
         if ((std::abs(pid_a) == 4) || (std::abs(pid_a) == 5))
-          M = PythiaFunction.particleData.m0(pid_a);
+          M = JetScapePythiaStore::ParticleData().m0(pid_a);
 
         double energy = (z * new_parent_nu + (tQd1 + k_perp1_2 + M * M) /
                                                  (2.0 * z * new_parent_nu)) /
@@ -1431,7 +1429,7 @@ void Matter::DoEnergyLoss(double deltaT, double time, double Q2,
 
         M = 0.0;
         if ((std::abs(pid_b) == 4) || (std::abs(pid_b) == 5))
-          M = PythiaFunction.particleData.m0(pid_b);
+          M = JetScapePythiaStore::ParticleData().m0(pid_b);
         ;
 
         energy =
@@ -1990,8 +1988,8 @@ double Matter::generate_vac_t_w_M(int p_id, double M, double nu, double t0,
   double r, z, ratio, diff, scale, t_low_M0, t_low_MM, t_low_00, t_hi_M0,
       t_hi_MM, t_hi_00, t_mid_M0, t_mid_MM, t_mid_00, numer, denom, test;
 
-  double M_charm = PythiaFunction.particleData.m0(cid);
-  double M_bottom = PythiaFunction.particleData.m0(bid);
+  double M_charm = JetScapePythiaStore::ParticleData().m0(cid);
+  double M_bottom = JetScapePythiaStore::ParticleData().m0(bid);
 
   // r = double(random())/ (maxN );
   r = ZeroOneDistribution(*GetMt19937Generator());
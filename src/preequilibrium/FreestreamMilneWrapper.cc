@@ -73,8 +73,9 @@ void FreestreamMilneWrapper::EvolvePreequilibrium() {
   VERBOSE(8);
   JSINFO << "Initialize energy density profile in freestream-milne ...";
   // grab initial energy density from vector from initial state module
-  std::vector<double> entropy_density =
+  const std::vector<double> &entropy_density =
       ini->GetEntropyDensityDistribution(); //note that this is the energy density when read by freestream-milne, not actually the entropy density!
+  // freestream-milne only takes a float profile
   std::vector<float> entropy_density_float(entropy_density.begin(),
                                            entropy_density.end());
   fsmilne_ptr->initialize_from_vector(entropy_density_float);
@@ -87,31 +88,39 @@ void FreestreamMilneWrapper::EvolvePreequilibrium() {
   }
   // now prepare to send the resulting hydro variables to the hydro module by coping hydro vectors to Preequilibrium base class members
  preequilibrium_tau_max_ = fsmilne_ptr->tau_LandauMatch;
-  fsmilne_ptr->output_to_vectors(e_, P_, utau_, ux_, uy_, ueta_, pi00_, pi01_,
-                                 pi02_, pi03_, pi11_, pi12_, pi13_, pi22_,
-                                 pi23_, pi33_, bulk_Pi_);
+  // freestream-milne fills the component vectors of the field directly
+  tmunu_.clear();
+  fsmilne_ptr->output_to_vectors(
+      tmunu_[TmunuField::E], tmunu_[TmunuField::P], tmunu_[TmunuField::UTAU],
+      tmunu_[TmunuField::UX], tmunu_[TmunuField::UY],
+      tmunu_[TmunuField::UETA], tmunu_[TmunuField::PI00],
+      tmunu_[TmunuField::PI01], tmunu_[TmunuField::PI02],
+      tmunu_[TmunuField::PI03], tmunu_[TmunuField::PI11],
+      tmunu_[TmunuField::PI12], tmunu_[TmunuField::PI13],
+      tmunu_[TmunuField::PI22], tmunu_[TmunuField::PI23],
+      tmunu_[TmunuField::PI33], tmunu_[TmunuField::BULK_PI]);
 }
 
 
 void FreestreamMilneWrapper::get_fluid_cell_with_index(
-        const int idx, std::unique_ptr<FluidCellInfo> &info_ptr) {
+        const int idx, FluidCellInfo &info) {
     fluidCell fluidCell_ptr;
     fsmilne_ptr->get_fluid_cell_with_index(idx, fluidCell_ptr);
-    info_ptr->energy_density = fluidCell_ptr.ed;
-    info_ptr->entropy_density = fluidCell_ptr.sd;
-    info_ptr->temperature = fluidCell_ptr.temperature;
-    info_ptr->pressure = fluidCell_ptr.pressure;
-    info_ptr->vx = fluidCell_ptr.vx;
-    info_ptr->vy = fluidCell_ptr.vy;
-    info_ptr->vz = fluidCell_ptr.vz;
-    info_ptr->mu_B = 0.0;
-    info_ptr->mu_C = 0.0;
-    info_ptr->mu_S = 0.0;
-    info_ptr->qgp_fraction = 0.0;
+    info.energy_density = fluidCell_ptr.ed;
+    info.entropy_density = fluidCell_ptr.sd;
+    info.temperature = fluidCell_ptr.temperature;
+    info.pressure = fluidCell_ptr.pressure;
+    info.vx = fluidCell_ptr.vx;
+    info.vy = fluidCell_ptr.vy;
+    info.vz = fluidCell_ptr.vz;
+    info.mu_B = 0.0;
+    info.mu_C = 0.0;
+    info.mu_S = 0.0;
+    info.qgp_fraction = 0.0;
     for (int i = 0; i < 4; i++) {
       for (int j = 0; j < 4; j++) {
-        info_ptr->pi[i][j] = fluidCell_ptr.pi[i][j];
+        info.pi[i][j] = fluidCell_ptr.pi[i][j];
       }
     }
-    info_ptr->bulk_Pi = fluidCell_ptr.bulkPi;
+    info.bulk_Pi = fluidCell_ptr.bulkPi;
 }
@@ -40,8 +40,7 @@ public:
       return(fsmilne_ptr->get_number_of_fluid_cells());
   }
 
-  void get_fluid_cell_with_index(
-          const int idx, std::unique_ptr<FluidCellInfo> &info_ptr);
+  void get_fluid_cell_with_index(const int idx, FluidCellInfo &info);
   void clear_evolution_data() { fsmilne_ptr->clear_evolution_data(); }
 
   Jetscape::real GetPreequilibriumStartTime() const {
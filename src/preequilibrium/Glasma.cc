@@ -24,6 +24,7 @@
 #include "Glasma.h"
 
 using Jetscape::hbarC;
+using Jetscape::TmunuField;
 
 // Register the module with the base class
 RegisterJetScapeModule<Glasma> Glasma::reg("Glasma");
@@ -45,35 +46,43 @@ void Glasma::EvolvePreequilibrium() {
     }
     std::string tempString;
     std::getline(IPGFile, tempString);
+    // one cell per data line; size the field once and fill it in place
+    const std::streampos data_start = IPGFile.tellg();
+    std::size_t n_cells = 0;
+    while (std::getline(IPGFile, tempString)) {
+        if (tempString.find_first_not_of(" \t\r") != std::string::npos) {
+            n_cells++;
+        }
+    }
+    IPGFile.clear();
+    IPGFile.seekg(data_start);
+    tmunu_.Allocate(n_cells);
+    auto &e = tmunu_[TmunuField::E];
+    auto &P = tmunu_[TmunuField::P];
+    auto &utau = tmunu_[TmunuField::UTAU];
+    auto &ux = tmunu_[TmunuField::UX];
+    auto &uy = tmunu_[TmunuField::UY];
+    auto &ueta = tmunu_[TmunuField::UETA];
     double dummy;
     IPGFile >> dummy;
-    while (!IPGFile.eof()) {
+    for (std::size_t idx = 0; idx < n_cells && !IPGFile.eof(); idx++) {
         double e_local;
         double u[4];
-        double pi[10];
         IPGFile >> dummy >> dummy;
         IPGFile >> e_local >> u[0] >> u[1] >> u[2] >> u[3];
-        e_.push_back(norm*e_local*hbarC);
-        P_.push_back(norm*e_local*hbarC/3.);
-        utau_.push_back(u[0]);
-        ux_.push_back(u[1]);
-        uy_.push_back(u[2]);
-        ueta_.push_back(u[3]);
+        e[idx] = norm*e_local*hbarC;
+        P[idx] = norm*e_local*hbarC/3.;
+        utau[idx] = u[0];
+        ux[idx] = u[1];
+        uy[idx] = u[2];
+        ueta[idx] = u[3];
+        // pi^{00} ... pi^{33} are adjacent components of the field
         for (int i = 0; i < 10; i++) {
-            IPGFile >> pi[i];
-            pi[i] *= norm*hbarC;
+            double pi;
+            IPGFile >> pi;
+            tmunu_[TmunuField::Component(TmunuField::PI00 + i)][idx] =
+                pi*norm*hbarC;
         }
-        pi00_.push_back(pi[0]);
-        pi01_.push_back(pi[1]);
-        pi02_.push_back(pi[2]);
-        pi03_.push_back(pi[3]);
-        pi11_.push_back(pi[4]);
-        pi12_.push_back(pi[5]);
-        pi13_.push_back(pi[6]);
-        pi22_.push_back(pi[7]);
-        pi23_.push_back(pi[8]);
-        pi33_.push_back(pi[9]);
-        bulk_Pi_.push_back(0.);
         IPGFile >> dummy;
     }
     preequilibrium_status_ = DONE;
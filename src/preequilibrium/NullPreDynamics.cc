@@ -32,29 +32,12 @@ NullPreDynamics::NullPreDynamics() {
 void NullPreDynamics::EvolvePreequilibrium() {
   VERBOSE(2) << "Initialize energy density profile in NullPreDynamics ...";
   // grab initial energy density from vector from initial state module
-  std::vector<double> energy_density = ini->GetEntropyDensityDistribution();
+  const std::vector<double> &energy_density =
+      ini->GetEntropyDensityDistribution();
   preequilibrium_status_ = INIT;
   if (preequilibrium_status_ == INIT) {
     VERBOSE(2) << "running NullPreDynamics ...";
-    for (auto const &e_local : energy_density) {
-      e_.push_back(e_local);
-      P_.push_back(e_local / 3.);
-      utau_.push_back(1.);
-      ux_.push_back(0.);
-      uy_.push_back(0.);
-      ueta_.push_back(0.);
-      pi00_.push_back(0.);
-      pi01_.push_back(0.);
-      pi02_.push_back(0.);
-      pi03_.push_back(0.);
-      pi11_.push_back(0.);
-      pi12_.push_back(0.);
-      pi13_.push_back(0.);
-      pi22_.push_back(0.);
-      pi23_.push_back(0.);
-      pi33_.push_back(0.);
-      bulk_Pi_.push_back(0.);
-    }
+    tmunu_.FillIdealFluidAtRest(energy_density);
     preequilibrium_status_ = DONE;
   }
 }
@@ -0,0 +1,220 @@
+/*******************************************************************************
+ * Copyright (c) The JETSCAPE Collaboration, 2018
+ *
+ * Modular, task-based framework for simulating all aspects of heavy-ion collisions
+ *
+ * For the list of contributors see AUTHORS.
+ *
+ * Report issues at https://github.com/JETSCAPE/JETSCAPE/issues
+ *
+ * or via email to bugs.jetscape@gmail.com
+ *
+ * Distributed under the GNU General Public License 3.0 (GPLv3 or later).
+ * See COPYING for details.
+ ******************************************************************************/
+
+#ifndef JETSCAPEANALYSISDRIVER_H
+#define JETSCAPEANALYSISDRIVER_H
+
+#include "JetScapeReader.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Jetscape {
+
+/// What the driver knows about one input file once it has been read
+struct AnalysisFileSummary {
+  std::string file_name;
+  bool ok = false;
+  int n_events = 0;          ///< events read, also those without particles
+  double sum_weights = 0.;   ///< sum of the event weights (1 if not written)
+  double sigma_gen = -1.;    ///< last cross section estimate in the file
+  double sigma_err = -1.;
+};
+
+/** Runs an analysis over many JetScape Ascii output files with a pool of
+    threads. Every file is read by its own JetScapeReader into a fresh copy
+    of the prototype analysis; the finished file results are merged into one
+    result per thread, and those into the final result after the pool is
+    done. Files ending in ".gz" are read with JetScapeReaderAsciiGZ.
+
+    The Analysis class has to be copy constructible and provide
+      template <class Reader> void Analyze(Reader &reader, double weight);
+          called once per event, after reader.Next()
+      void Finish(const AnalysisFileSummary &file);
+          called once per file, e.g. to normalize with sigma_gen / sum_weights
+      void Merge(const Analysis &other);
+          adds a finished file, or the result of another thread
+    Files are handed out in order, but the order in which results are merged
+    depends on the thread timing, so sums can differ in the last bits
+    between runs with more than one thread.
+ */
+template <class Analysis> class JetScapeAnalysisDriver {
+
+public:
+  JetScapeAnalysisDriver(const Analysis &m_prototype = Analysis())
+      : prototype(m_prototype), result(m_prototype) {}
+
+  void AddFile(const std::string &file_name) { fileNames.push_back(file_name); }
+  /// Reads file names from a text file, one per line
+  bool AddFileList(const std::string &list_name);
+  int GetNumberOfFiles() const { return fileNames.size(); }
+
+  /// 0 uses std::thread::hardware_concurrency()
+  void SetNumberOfThreads(int n) { nThreads = n; }
+  int GetNumberOfThreads() const;
+  void SetHadronOnly(bool m_hadron_only) { hadronOnly = m_hadron_only; }
+
+  /// Returns false if any of the files could not be read
+  bool Run();
+
+  const Analysis &GetResult() const { return result; }
+  /// In the order the files were added
+  const std::vector<AnalysisFileSummary> &GetFileSummaries() const {
+    return summaries;
+  }
+
+private:
+  template <class Reader>
+  void ProcessFile(const std::string &file_name, Analysis &analysis,
+                   AnalysisFileSummary &summary);
+  void Worker();
+
+  Analysis prototype;
+  Analysis result;
+  std::vector<std::string> fileNames;
+  std::vector<AnalysisFileSummary> summaries;
+  int nThreads = 0;
+  bool hadronOnly = true;
+
+  std::atomic<unsigned int> nextFile{0};
+  std::mutex resultMutex;
+};
+
+template <class Analysis>
+bool JetScapeAnalysisDriver<Analysis>::AddFileList(
+    const std::string &list_name) {
+  std::ifstream list(list_name.c_str());
+  if (!list.good()) {
+    JSWARN << "Cannot open file list " << list_name;
+    return false;
+  }
+  std::string line;
+  while (std::getline(list, line)) {
+    line.erase(0, line.find_first_not_of(" \t"));
+    line.erase(line.find_last_not_of(" \t\r") + 1);
+    if (!line.empty() && line[0] != '#')
+      AddFile(line);
+  }
+  return true;
+}
+
+template <class Analysis>
+int JetScapeAnalysisDriver<Analysis>::GetNumberOfThreads() const {
+  int n = nThreads > 0 ? nThreads : std::thread::hardware_concurrency();
+  return std::max(1, std::min<int>(n, fileNames.size()));
+}
+
+template <class Analysis>
+template <class Reader>
+void JetScapeAnalysisDriver<Analysis>::ProcessFile(
+    const std::string &file_name, Analysis &analysis,
+    AnalysisFileSummary &summary) {
+  auto reader = std::make_shared<Reader>(file_name);
+  reader->SetHadronOnly(hadronOnly);
+
+  while (!reader->Finished()) {
+    reader->Next();
+
+    // sigmaGen and sigmaErr are running estimates, keep the last one
+    if (reader->GetSigmaGen() >= 0.) {
+      summary.sigma_gen = reader->GetSigmaGen();
+      summary.sigma_err = reader->GetSigmaErr();
+    }
+
+    // every event counts, also one without hadrons or partons; only a
+    // block without an event header, such as a trailer, is skipped
+    if (!reader->IsEvent())
+      continue;
+
+    double weight = reader->GetEventWeight() >= 0. ? reader->GetEventWeight()
+                                                   : 1.;
+    analysis.Analyze(*reader, weight);
+    summary.n_events++;
+    summary.sum_weights += weight;
+  }
+  reader->Close();
+  summary.ok = true;
+}
+
+template <class Analysis> void JetScapeAnalysisDriver<Analysis>::Worker() {
+  Analysis threadResult(prototype);
+
+  unsigned int i;
+  while ((i = nextFile++) < fileNames.size()) {
+    const std::string &file_name = fileNames[i];
+    AnalysisFileSummary &summary = summaries[i];
+    summary.file_name = file_name;
+
+    // The reader exits on files it cannot open, check here instead
+    if (!std::ifstream(file_name.c_str()).good()) {
+      JSWARN << "Cannot open " << file_name << ", skipping it";
+      continue;
+    }
+
+    Analysis fileResult(prototype);
+    bool gz = file_name.size() > 3 &&
+              file_name.compare(file_name.size() - 3, 3, ".gz") == 0;
+    if (gz) {
+#ifdef USE_GZIP
+      ProcessFile<JetScapeReaderAsciiGZ>(file_name, fileResult, summary);
+#else
+      JSWARN << "Compiled without gzip support, skipping " << file_name;
+      continue;
+#endif
+    } else {
+      ProcessFile<JetScapeReaderAscii>(file_name, fileResult, summary);
+    }
+
+    fileResult.Finish(summary);
+    threadResult.Merge(fileResult);
+  }
+
+  std::lock_guard<std::mutex> lock(resultMutex);
+  result.Merge(threadResult);
+}
+
+template <class Analysis> bool JetScapeAnalysisDriver<Analysis>::Run() {
+  result = prototype;
+  summaries.assign(fileNames.size(), AnalysisFileSummary());
+  nextFile = 0;
+
+  int n = GetNumberOfThreads();
+  JSINFO << "Analyzing " << fileNames.size() << " files with " << n
+         << " threads";
+
+  std::vector<std::thread> pool;
+  for (int t = 0; t < n; t++)
+    pool.emplace_back(&JetScapeAnalysisDriver<Analysis>::Worker, this);
+  for (auto &t : pool)
+    t.join();
+
+  int nFailed = std::count_if(
+      summaries.begin(), summaries.end(),
+      [](const AnalysisFileSummary &s) { return !s.ok; });
+  if (nFailed > 0)
+    JSWARN << nFailed << " of " << fileNames.size()
+           << " files could not be read";
+  return nFailed == 0;
+}
+
+} // end namespace Jetscape
+
+#endif // JETSCAPEANALYSISDRIVER_H
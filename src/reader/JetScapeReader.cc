@@ -14,10 +14,81 @@
  ******************************************************************************/
 
 #include "JetScapeReader.h"
-#include <sstream>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string_view>
 
 namespace Jetscape {
 
+namespace {
+
+// Same delimiters as the StringTokenizer default, " \t\v\n\r\f=>[]"
+inline bool IsDelimiter(char c) {
+  switch (c) {
+  case ' ':
+  case '\t':
+  case '\v':
+  case '\n':
+  case '\r':
+  case '\f':
+  case '=':
+  case '>':
+  case '[':
+  case ']':
+    return true;
+  default:
+    return false;
+  }
+}
+
+inline void SkipDelimiters(const char *&p, const char *end) {
+  while (p < end && IsDelimiter(*p))
+    ++p;
+}
+
+// Skips a non-numeric token such as the V, P or H tags
+inline bool SkipToken(const char *&p, const char *end) {
+  SkipDelimiters(p, end);
+  const char *start = p;
+  while (p < end && !IsDelimiter(*p))
+    ++p;
+  return p != start;
+}
+
+// Parses the next field in place, advancing p past it
+template <class V> inline bool ReadField(const char *&p, const char *end,
+                                         V &value) {
+  SkipDelimiters(p, end);
+  auto result = std::from_chars(p, end, value);
+  if (result.ec != std::errc())
+    return false;
+  p = result.ptr;
+  return true;
+}
+
+// Header comments look like "# <writer id>sigmaGen <value>"
+inline bool ReadValueAfter(const char *begin, const char *end,
+                           std::string_view key, double &value) {
+  std::string_view line(begin, end - begin);
+  size_t pos = line.find(key);
+  if (pos == std::string_view::npos)
+    return false;
+  const char *p = begin + pos + key.size();
+  return ReadField(p, end, value);
+}
+
+// Same criterion as StringTokenizer::isEventEntry() for non-comment lines
+inline bool IsEventEntry(const char *begin, const char *end) {
+  std::string_view line(begin, end - begin);
+  return !line.empty() && line[0] != '#' && line.find("Event") < 100;
+}
+
+const size_t readChunkSize = 1 << 20;
+
+} // namespace
+
 template <class T> JetScapeReader<T>::JetScapeReader():
   currentEvent{-1}
   , sigmaGen{-1}
@@ -31,10 +102,9 @@ template <class T> JetScapeReader<T>::JetScapeReader():
 template <class T> JetScapeReader<T>::~JetScapeReader() { VERBOSE(8); }
 
 template <class T> void JetScapeReader<T>::Clear() {
-  nodeVec.clear();
-  edgeVec.clear();
-  //pShower->clear();//pShower=nullptr; //check ...
+  showerColumns.clear();
   pShowers.clear();
+  hadronRecords.clear();
   hadrons.clear();
 
   sigmaGen = -1;
@@ -43,175 +113,304 @@ template <class T> void JetScapeReader<T>::Clear() {
   EventPlaneAngle = 0.0;
 }
 
-template <class T> void JetScapeReader<T>::AddNode(string s) {
-  string token;
-  //int counter=0;
-  strT.set(s);
-
-  vector<string> vS;
-
-  while (!strT.done()) {
-    token = strT.next();
-    if (token.compare("V") != 0)
-      vS.push_back(token);
+template <class T> void JetScapeReader<T>::AddNode(const char *begin,
+                                                   const char *end) {
+  const char *p = begin;
+  int id;
+  double x, y, z, t;
+  if (!(ReadField(p, end, id) && SkipToken(p, end) && ReadField(p, end, x) &&
+        ReadField(p, end, y) && ReadField(p, end, z) &&
+        ReadField(p, end, t))) {
+    JSWARN << "Malformed vertex entry, skipping: " << string(begin, end);
+    return;
   }
 
-  nodeVec.push_back(pShower->new_vertex(
-      make_shared<Vertex>(stod(vS[1]), stod(vS[2]), stod(vS[3]), stod(vS[4]))));
+  auto &c = showerColumns.back();
+  c.vx.push_back(x);
+  c.vy.push_back(y);
+  c.vz.push_back(z);
+  c.vt.push_back(t);
 }
 
-template <class T> void JetScapeReader<T>::AddEdge(string s) {
-  if (nodeVec.size() > 1) {
-    string token;
-    //int counter=0;
-    strT.set(s);
-
-    vector<string> vS;
-
-    while (!strT.done()) {
-      token = strT.next();
-      if (token.compare("P") != 0)
-        vS.push_back(token);
+template <class T> void JetScapeReader<T>::AddEdge(const char *begin,
+                                                   const char *end) {
+  auto &c = showerColumns.back();
+  int nNodes = c.GetNumberOfVertices();
+  if (nNodes > 1) {
+    const char *p = begin;
+    int in, out, label, id, stat;
+    double pt, eta, phi, e;
+    if (!(ReadField(p, end, in) && ReadField(p, end, out) &&
+          SkipToken(p, end) && ReadField(p, end, label) &&
+          ReadField(p, end, id) && ReadField(p, end, stat) &&
+          ReadField(p, end, pt) && ReadField(p, end, eta) &&
+          ReadField(p, end, phi) && ReadField(p, end, e)) ||
+        in < 0 || out < 0 || in >= nNodes || out >= nNodes) {
+      JSWARN << "Malformed parton entry, skipping: " << string(begin, end);
+      return;
     }
 
-    pShower->new_parton(
-        nodeVec[stoi(vS[0])], nodeVec[stoi(vS[1])],
-        make_shared<Parton>(
-            stoi(vS[2]), stoi(vS[3]), stoi(vS[4]), stod(vS[5]), stod(vS[6]),
-            stod(vS[7]),
-            stod(
-                vS[8]))); // use different constructor wit true spatial posiiton ...
+    c.edges.emplace_back(in, out);
+    c.label.push_back(label);
+    c.pid.push_back(id);
+    c.pstat.push_back(stat);
+    c.pt.push_back(pt);
+    c.eta.push_back(eta);
+    c.phi.push_back(phi);
+    c.e.push_back(e);
   } else
     JSWARN << "Node vector not filled, can not add edges/partons!";
 }
 
-template <class T> void JetScapeReader<T>::AddHadron(string s) {
-  string token;
-  strT.set(s);
-
-  vector<string> vS;
-  double x[4];
-  x[0] = x[1] = x[2] = x[3] = 0.0;
-  while (!strT.done()) {
-    token = strT.next();
-    if (token.compare("H") != 0)
-      vS.push_back(token);
+template <class T> void JetScapeReader<T>::AddHadron(const char *begin,
+                                                     const char *end) {
+  const char *p = begin;
+  int index;
+  HadronRecord h;
+  if (!(ReadField(p, end, index) && SkipToken(p, end) &&
+        ReadField(p, end, h.label) && ReadField(p, end, h.id) &&
+        ReadField(p, end, h.stat) && ReadField(p, end, h.pt) &&
+        ReadField(p, end, h.eta) && ReadField(p, end, h.phi) &&
+        ReadField(p, end, h.e))) {
+    JSWARN << "Malformed hadron entry, skipping: " << string(begin, end);
+    return;
   }
-  hadrons.push_back(make_shared<Hadron>(stoi(vS[1]), stoi(vS[2]), stoi(vS[3]),
-                                        stod(vS[4]), stod(vS[5]), stod(vS[6]),
-                                        stod(vS[7]), x));
+  hadronRecords.push_back(h);
 }
 
-template <class T> void JetScapeReader<T>::Next() {
-  if (currentEvent > 0)
-    Clear();
+template <class T>
+void JetScapeReader<T>::ParseComment(const char *begin, const char *end) {
+  // Cross section
+  if (ReadValueAfter(begin, end, "sigmaGen", sigmaGen))
+    JSDEBUG << " sigma gen=" << sigmaGen;
+  // Cross section error
+  if (ReadValueAfter(begin, end, "sigmaErr", sigmaErr))
+    JSDEBUG << " sigma err=" << sigmaErr;
+  // Event weight
+  if (ReadValueAfter(begin, end, "weight", eventWeight))
+    JSDEBUG << " Event weight=" << eventWeight;
+  // EP angle
+  if (ReadValueAfter(begin, end, "EventPlaneAngle", EventPlaneAngle))
+    JSDEBUG << " EventPlaneAngle=" << EventPlaneAngle;
+}
 
-  //ReadEvent(currentPos);
-  string line;
-  string token;
+template <class T> bool JetScapeReader<T>::FillBuffer() {
+  if (!inFile.good())
+    return false;
 
-  JSINFO << "Current Event = " << currentEvent;
+  size_t oldSize = readBuffer.size();
+  readBuffer.resize(oldSize + readChunkSize);
+  inFile.read(&readBuffer[oldSize], readChunkSize);
+  readBuffer.resize(oldSize + inFile.gcount());
 
-  pShowers.push_back(make_shared<PartonShower>());
-  pShower = pShowers[0];
-  currentShower = 1;
+  return inFile.gcount() > 0;
+}
 
-  int nodeZeroCounter = 0;
-  std::string EPAngleStr = "EventPlaneAngle";
-  while (getline(inFile, line)) {
-    strT.set(line);
-
-    if (strT.isCommentEntry()) {
-
-      // Cross section
-      if (line.find("sigmaGen") != std::string::npos) {
-        std::stringstream data(line);
-        std::string dummy;
-        data >> dummy >> dummy >> dummy >> sigmaGen;
-        JSDEBUG << " sigma gen=" << sigmaGen;
-      }
-      // Cross section error
-      if (line.find("sigmaErr") != std::string::npos) {
-        std::stringstream data(line);
-        std::string dummy;
-        data >> dummy >> dummy >> dummy >> sigmaErr;
-        JSDEBUG << " sigma err=" << sigmaErr;
-      }
-      // Event weight
-      if (line.find("weight") != std::string::npos) {
-        std::stringstream data(line);
-        std::string dummy;
-        data >> dummy >> dummy >> dummy >> eventWeight;
-        JSDEBUG << " Event weight=" << eventWeight;
-      }
-      // EP angle
-      if (line.find(EPAngleStr) != std::string::npos) {
-        std::stringstream data(line);
-        std::string dummy;
-        data >> dummy >> dummy >> dummy >> EventPlaneAngle;
-        JSDEBUG << " EventPlaneAngle=" << EventPlaneAngle;
-      }
-      continue;
+// Extends the buffer until it holds the complete current event and returns
+// the end of that block. The header of the following event is consumed,
+// just as the line-by-line reader did.
+template <class T> size_t JetScapeReader<T>::ReadEventBlock() {
+  readBuffer.erase(0, readPos);
+  readPos = 0;
+  // the header of this block, if any, was consumed by the previous call
+  eventHeader = nextEventHeader;
+  nextEventHeader = false;
+
+  size_t lineBegin = 0;
+  while (true) {
+    size_t lineEnd = readBuffer.find('\n', lineBegin);
+    if (lineEnd == string::npos) {
+      if (FillBuffer())
+        continue;
+      lineEnd = readBuffer.size();
+      if (lineBegin >= lineEnd)
+        break;
     }
 
-    if (strT.isEventEntry()) {
-      int newEvent = stoi(strT.next());
+    const char *first = readBuffer.data() + lineBegin;
+    const char *last = readBuffer.data() + lineEnd;
+    if (IsEventEntry(first, last)) {
+      int newEvent = -1;
+      ReadField(first, last, newEvent);
       if (currentEvent != newEvent && currentEvent > -1) {
         currentEvent++;
-        break;
+        nextEventHeader = true;
+        readPos = std::min(lineEnd + 1, readBuffer.size());
+        return lineBegin;
       }
       currentEvent = newEvent;
-      continue;
+      eventHeader = true;
     }
+    lineBegin = lineEnd + 1;
+  }
+
+  readPos = readBuffer.size();
+  return readPos;
+}
+
+template <class T>
+void JetScapeReader<T>::ParseEventBlock(const char *begin, const char *end) {
+  int nodeZeroCounter = 0;
 
-    // not an event header -- done?
-    if (!strT.isGraphEntry())
-      continue;
-
-    // node?
-    if (strT.isNodeEntry()) {
-      // catch starting node
-      if (strT.isNodeZero()) {
-        nodeZeroCounter++;
-        if (nodeZeroCounter > currentShower) {
-          nodeVec.clear();
-          edgeVec.clear();
-          pShowers.push_back(make_shared<PartonShower>());
-          pShower = pShowers.back();
-          currentShower++;
+  for (const char *line = begin; line < end;) {
+    const char *eol =
+        static_cast<const char *>(std::memchr(line, '\n', end - line));
+    if (!eol)
+      eol = end;
+    std::string_view entry(line, eol - line);
+
+    if (entry.empty()) {
+      // nothing to do
+    } else if (entry[0] == '#') {
+      ParseComment(line, eol);
+    } else if (IsEventEntry(line, eol)) {
+      // event header, handled in ReadEventBlock
+    } else if (entry[0] != '[') {
+      // not a graph or hadron entry
+    } else if (entry.find("] V") != std::string_view::npos) {
+      if (!hadronOnly) {
+        // catch starting node
+        if (entry.compare(0, 3, "[0]") == 0) {
+          nodeZeroCounter++;
+          if (nodeZeroCounter > currentShower) {
+            showerColumns.emplace_back();
+            currentShower++;
+          }
         }
+        AddNode(line, eol);
       }
-      AddNode(line);
-      continue;
-    }
-
-    // edge?
-    if (strT.isEdgeEntry()) {
-      AddEdge(line);
-      continue;
+    } else if (entry.find("]=>[") != std::string_view::npos) {
+      if (!hadronOnly)
+        AddEdge(line, eol);
+    } else {
+      // rest is list entry == hadron entry
+      AddHadron(line, eol);
     }
 
-    // rest is list entry == hadron entry
-    // Some questionable nomenclature here - identifying all that begins with "[" as "GraphEntry"
-    // oh well
-    AddHadron(line);
+    line = eol + 1;
   }
+}
+
+template <class T> void JetScapeReader<T>::Next() {
+  if (currentEvent > 0)
+    Clear();
+
+  JSINFO << "Current Event = " << currentEvent;
+
+  if (!hadronOnly)
+    showerColumns.emplace_back();
+  currentShower = 1;
+
+  size_t blockEnd = ReadEventBlock();
+  ParseEventBlock(readBuffer.data(), readBuffer.data() + blockEnd);
 
   if (Finished())
     currentEvent++;
 }
 
+template <class T>
+shared_ptr<PartonShower>
+JetScapeReader<T>::MakePartonShower(const PartonShowerColumns &c) {
+  auto pShower = make_shared<PartonShower>();
+
+  vector<node> nodeVec;
+  nodeVec.reserve(c.GetNumberOfVertices());
+  for (int i = 0; i < c.GetNumberOfVertices(); i++) {
+    nodeVec.push_back(pShower->new_vertex(
+        make_shared<Vertex>(c.vx[i], c.vy[i], c.vz[i], c.vt[i])));
+  }
+
+  for (int i = 0; i < c.GetNumberOfPartons(); i++) {
+    pShower->new_parton(
+        nodeVec[c.edges[i].first], nodeVec[c.edges[i].second],
+        make_shared<Parton>(
+            c.label[i], c.pid[i], c.pstat[i], c.pt[i], c.eta[i], c.phi[i],
+            c.e[i])); // use different constructor wit true spatial posiiton ...
+  }
+
+  return pShower;
+}
+
+template <class T>
+vector<shared_ptr<PartonShower>> JetScapeReader<T>::GetPartonShowers() {
+  if (pShowers.size() != showerColumns.size()) {
+    pShowers.clear();
+    pShowers.reserve(showerColumns.size());
+    for (auto &c : showerColumns)
+      pShowers.push_back(MakePartonShower(c));
+  }
+  return pShowers;
+}
+
+template <class T>
+vector<shared_ptr<Hadron>> JetScapeReader<T>::GetHadrons() {
+  // Hadrons are only built once per event, and only if asked for
+  if (hadrons.size() != hadronRecords.size()) {
+    hadrons.clear();
+    hadrons.reserve(hadronRecords.size());
+    double x[4] = {0.0, 0.0, 0.0, 0.0};
+    for (auto &h : hadronRecords) {
+      hadrons.push_back(make_shared<Hadron>(h.label, h.id, h.stat, h.pt, h.eta,
+                                            h.phi, h.e, x));
+    }
+  }
+  return hadrons;
+}
+
 template <class T>
 vector<fjcore::PseudoJet> JetScapeReader<T>::GetHadronsForFastJet() {
   vector<fjcore::PseudoJet> forFJ;
+  forFJ.reserve(hadronRecords.size());
 
-  for (auto &h : hadrons) {
-    forFJ.push_back(h->GetPseudoJet());
+  // Same momentum as Hadron::GetPseudoJet(), without building the Hadron
+  for (auto &h : hadronRecords) {
+    forFJ.emplace_back(h.pt * cos(h.phi), h.pt * sin(h.phi),
+                       h.pt * sinh(h.eta), h.e);
   }
 
   return forFJ;
 }
 
+void PartonShowerColumns::clear() {
+  vx.clear();
+  vy.clear();
+  vz.clear();
+  vt.clear();
+  label.clear();
+  pid.clear();
+  pstat.clear();
+  pt.clear();
+  eta.clear();
+  phi.clear();
+  e.clear();
+  edges.clear();
+}
+
+vector<int> PartonShowerColumns::GetParentIndices() const {
+  // parton entering each vertex
+  vector<int> incoming(GetNumberOfVertices(), -1);
+  for (int i = 0; i < GetNumberOfPartons(); i++)
+    incoming[edges[i].second] = i;
+
+  vector<int> parents(GetNumberOfPartons(), -1);
+  for (int i = 0; i < GetNumberOfPartons(); i++)
+    parents[i] = incoming[edges[i].first];
+  return parents;
+}
+
+vector<int> PartonShowerColumns::GetFinalPartonIndices() const {
+  vector<bool> hasOutgoing(GetNumberOfVertices(), false);
+  for (auto &edge : edges)
+    hasOutgoing[edge.first] = true;
+
+  vector<int> finals;
+  for (int i = 0; i < GetNumberOfPartons(); i++) {
+    if (!hasOutgoing[edges[i].second])
+      finals.push_back(i);
+  }
+  return finals;
+}
+
 template <class T> void JetScapeReader<T>::Init() {
   VERBOSE(8) << "Open Input File = " << file_name_in;
   JSINFO << "Open Input File = " << file_name_in;
@@ -36,6 +36,31 @@ using std::ifstream;
 
 namespace Jetscape {
 
+/** Graph-free view of one parton shower as it was written to file.
+    Vertices and partons are stored column-wise, in file order. Parton i
+    is the edge edges[i] = (source vertex, target vertex), so its index
+    matches PartonShower::GetPartonAt(i) of the corresponding graph.
+ */
+struct PartonShowerColumns {
+  // vertex positions
+  vector<double> vx, vy, vz, vt;
+  // parton kinematics
+  vector<int> label, pid, pstat;
+  vector<double> pt, eta, phi, e;
+  // edge list as (source, target) vertex index pairs
+  vector<std::pair<int, int>> edges;
+
+  int GetNumberOfVertices() const { return vt.size(); }
+  int GetNumberOfPartons() const { return edges.size(); }
+
+  /// Index of the parton entering the source vertex of each parton, -1 if none
+  vector<int> GetParentIndices() const;
+  /// Indices of the partons whose target vertex has no outgoing parton
+  vector<int> GetFinalPartonIndices() const;
+
+  void clear();
+};
+
 template <class T> class JetScapeReader {
 
 public:
@@ -50,15 +75,30 @@ public:
   void Clear();
 
   void Next();
-  bool Finished() { return inFile.eof(); }
+  bool Finished() { return inFile.eof() && readPos >= readBuffer.size(); }
+
+  /// In hadron-only mode shower vertices and partons are skipped while
+  /// parsing, no PartonShower graphs are built.
+  void SetHadronOnly(bool m_hadron_only) { hadronOnly = m_hadron_only; }
+  bool GetHadronOnly() const { return hadronOnly; }
 
   int GetCurrentEvent() { return currentEvent - 1; }
-  int GetCurrentNumberOfPartonShowers() { return pShowers.size(); }
+  /// False if the block read by Next() had no event header, e.g. an empty
+  /// file or text after the last event
+  bool IsEvent() const { return eventHeader; }
+  int GetCurrentNumberOfPartonShowers() { return showerColumns.size(); }
+
+  /// Flat per-shower columns, available without building any graph
+  const vector<PartonShowerColumns> &GetPartonShowerColumns() const {
+    return showerColumns;
+  }
 
   //shared_ptr<PartonShower> GetPartonShower() {return pShower;}
-  vector<shared_ptr<PartonShower>> GetPartonShowers() { return pShowers; }
+  /// The GTL graphs are only built from the columns on the first call per event
+  vector<shared_ptr<PartonShower>> GetPartonShowers();
 
-  vector<shared_ptr<Hadron>> GetHadrons() { return hadrons; }
+  vector<shared_ptr<Hadron>> GetHadrons();
+  int GetNumberOfHadrons() const { return hadronRecords.size(); }
   vector<fjcore::PseudoJet> GetHadronsForFastJet();
   double GetSigmaGen() const { return sigmaGen; }
   double GetSigmaErr() const { return sigmaErr; }
@@ -66,24 +106,40 @@ public:
   double GetEventPlaneAngle() const { return EventPlaneAngle; }
 
 private:
-  StringTokenizer strT;
+  // Kinematics of a hadron line as written by the Ascii writers.
+  // Hadron objects are only built from these on request.
+  struct HadronRecord {
+    int label, id, stat;
+    double pt, eta, phi, e;
+  };
 
   void Init();
-  void AddNode(string s);
-  void AddEdge(string s);
+  bool FillBuffer();
+  size_t ReadEventBlock();
+  void ParseEventBlock(const char *begin, const char *end);
+  void ParseComment(const char *begin, const char *end);
+  void AddNode(const char *begin, const char *end);
+  void AddEdge(const char *begin, const char *end);
   //void MakeGraph();
-  void AddHadron(string s);
+  void AddHadron(const char *begin, const char *end);
+  shared_ptr<PartonShower> MakePartonShower(const PartonShowerColumns &c);
   string file_name_in;
   T inFile;
 
+  // Raw file content, read in large chunks; [0, readPos) is consumed.
+  string readBuffer;
+  size_t readPos = 0;
+  bool hadronOnly = false;
+
   int currentEvent;
   int currentShower;
+  bool eventHeader = false;     // the current block has an event header
+  bool nextEventHeader = false; // the header of the next block was read
 
-  shared_ptr<PartonShower> pShower;
+  vector<PartonShowerColumns> showerColumns;
   vector<shared_ptr<PartonShower>> pShowers;
 
-  vector<node> nodeVec;
-  vector<edge> edgeVec;
+  vector<HadronRecord> hadronRecords;
   vector<shared_ptr<Hadron>> hadrons;
   double sigmaGen;
   double sigmaErr;